@@ -0,0 +1,160 @@
+// $Id$
+//==============================================================================
+//!
+//! \file CouplingAccelerator.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Convergence acceleration of partitioned coupling iterations.
+//!
+//==============================================================================
+
+#ifndef _COUPLING_ACCELERATOR_H
+#define _COUPLING_ACCELERATOR_H
+
+#include "MatVec.h"
+#include <deque>
+#include <string>
+
+class TiXmlElement;
+
+
+/*!
+  \brief Class for acceleration of block Gauss-Seidel coupling iterations.
+
+  \details The staggering cycle of two coupled solvers is viewed as a
+  fixed-point map \f$\tilde{\bf x} = {\bf H}({\bf x})\f$ on a selected
+  interface quantity \b x. After each cycle, the output of the map is
+  replaced by an updated iterate, using either constant relaxation,
+  dynamic Aitken relaxation, or the interface quasi-Newton method with an
+  inverse Jacobian from a least-squares model (IQN-ILS).
+  For IQN-ILS, the secant information from a given number of previous
+  time steps can be reused, which usually reduces the number of cycles
+  significantly also in the first iterations of each new time step.
+
+  The multi-vector variant (IQN-IMVJ) instead keeps the inverse Jacobian of
+  all previous time steps as a dense matrix, which is updated with the
+  secants of each converged time step. It needs no tuning of the number of
+  reused time steps, but its storage grows quadratically with the number
+  of interface values, so it is only suitable for small interfaces.
+*/
+
+class CouplingAccelerator
+{
+public:
+  //! \brief Available acceleration methods.
+  enum Method {
+    NONE,   //!< Plain block Gauss-Seidel (no acceleration)
+    FIXED,  //!< Constant under-relaxation
+    AITKEN, //!< Dynamic Aitken under-relaxation
+    IQN_ILS, //!< Interface quasi-Newton with least-squares inverse Jacobian
+    IQN_IMVJ //!< Interface quasi-Newton with multi-vector inverse Jacobian
+  };
+
+  //! \brief Default constructor.
+  //! \param[in] m The acceleration method to use
+  //! \param[in] omega Initial (or constant) relaxation factor
+  explicit CouplingAccelerator(Method m = NONE, double omega = 0.5);
+
+  //! \brief Parses acceleration parameters from an XML element.
+  //! \param[in] elem The \a acceleration element to parse
+  bool parse(const TiXmlElement* elem);
+
+  //! \brief Defines the acceleration method.
+  void setMethod(Method m) { method = m; }
+  //! \brief Returns the acceleration method.
+  Method getMethod() const { return method; }
+  //! \brief Returns \e true if acceleration is enabled.
+  bool active() const { return method != NONE && !fieldName.empty(); }
+
+  //! \brief Defines the name of the interface field to accelerate.
+  void setField(const std::string& name) { fieldName = name; }
+  //! \brief Returns the name of the interface field to accelerate.
+  const std::string& getField() const { return fieldName; }
+
+  //! \brief Defines the initial (or constant) relaxation factor.
+  //! \param[in] omega Initial (or constant) relaxation factor
+  //! \param[in] omax Bound on the Aitken relaxation factor (0: none)
+  void setOmega(double omega, double omax = 0.0)
+  {
+    omega0 = omega;
+    omegaMax = omax;
+  }
+  //! \brief Defines the filtering tolerance for the IQN-ILS secants.
+  void setTolerance(double tol) { eps = tol; }
+  //! \brief Defines the IQN-ILS history parameters.
+  //! \param[in] nStep Number of previous time steps to reuse secants from
+  //! \param[in] maxVec Maximum number of secant vectors to retain (0: all)
+  void setHistory(int nStep, size_t maxVec = 0)
+  {
+    reuse = nStep;
+    maxCol = maxVec;
+  }
+
+  //! \brief Initializes the iterations of a new time step.
+  //! \param[in] x Initial value of the interface quantity in this step
+  void initStep(const Vector& x);
+
+  //! \brief Computes the next iterate from the output of a coupling cycle.
+  //! \param x Output of the fixed-point map on input, new iterate on output
+  //! \return \e false if the interface vector has changed length
+  bool apply(Vector& x);
+
+  //! \brief Returns the Euclidean norm of the last interface residual.
+  double getResidual() const { return resNorm; }
+  //! \brief Returns the relaxation factor used in the last update.
+  double getOmega() const { return omega; }
+  //! \brief Returns the current number of secant vectors.
+  size_t getNoSecants() const { return V.size(); }
+  //! \brief Returns the initial (or constant) relaxation factor.
+  double getInitialOmega() const { return omega0; }
+  //! \brief Returns the number of previous time steps to reuse secants from.
+  int getReuse() const { return reuse; }
+
+  //! \brief Clears all iteration history.
+  void clear();
+
+protected:
+  //! \brief Computes the IQN-ILS update of the interface quantity.
+  //! \param x Output of the fixed-point map on input, new iterate on output
+  //! \param[in] r Current interface residual
+  //! \return \e false if no secant vectors are available
+  bool quasiNewton(Vector& x, const Vector& r) const;
+  //! \brief Updates the IQN-IMVJ inverse Jacobian with the current secants.
+  void updateJacobian();
+
+  //! \brief QR-decomposes the residual differences.
+  //! \param[out] col Indices of the retained columns of \a V
+  //! \param[out] Q Orthonormal vectors spanning the retained columns
+  //! \param[out] R Upper triangular factor, column by column
+  void factorize(std::vector<size_t>& col, std::vector<Vector>& Q,
+                 std::vector<RealArray>& R) const;
+
+private:
+  Method      method;    //!< Acceleration method
+  std::string fieldName; //!< Name of interface field to accelerate
+  double      omega0;    //!< Initial (or constant) relaxation factor
+  double      omegaMax;  //!< Bound on the Aitken relaxation factor (0: none)
+  int         reuse;     //!< Number of previous time steps to reuse
+  size_t      maxCol;    //!< Maximum number of secant vectors (0: unlimited)
+  double      eps;       //!< Filtering tolerance for the QR-decomposition
+
+  int    iter;    //!< Iteration counter within current time step
+  int    step;    //!< Time step counter
+  double omega;   //!< Current relaxation factor
+  double resNorm; //!< Norm of current interface residual
+
+  Vector xPrev;  //!< Previous iterate
+  Vector xtPrev; //!< Previous output of the fixed-point map
+  Vector rPrev;  //!< Previous interface residual
+
+  std::deque<Vector> V;     //!< Residual differences (newest first)
+  std::deque<Vector> W;     //!< Fixed-point map output differences
+  std::deque<int>    vStep; //!< Time step in which each secant was formed
+
+  Matrix J; //!< IQN-IMVJ inverse Jacobian of the previous time steps
+};
+
+#endif
@@ -14,12 +14,25 @@
 #ifndef SIM_COUPLED_SI_H_
 #define SIM_COUPLED_SI_H_
 
+#include "CouplingAccelerator.h"
 #include "SIMCoupled.h"
 #include "SIMenums.h"
+#include "tinyxml.h"
 
 
 /*!
   \brief Template class for semi-implicitly coupled simulators.
+
+  \details The staggering cycles may optionally be accelerated by relaxing a
+  selected interface field after each cycle, see CouplingAccelerator.
+  The field is located through the \a getField method of the two simulators,
+  and should be a quantity that is computed by the last solver in the cycle.
+  The acceleration is defined by the \a acceleration tag, e.g.,
+  \code
+  <acceleration type="iqn-ils" field="displacement" omega="0.5" reuse="2"/>
+  \endcode
+  where \a type is one of \a none, \a fixed, \a aitken, \a iqn-ils
+  and \a iqn-imvj.
 */
 
 template<class T1, class T2>
@@ -47,6 +60,18 @@ public:
       this->S1.getProcessAdm().cout <<"\n  step="<< tp.step
                                     <<"  time="<< tp.time.t << std::endl;
 
+    Vector* iField = nullptr;
+    if (accel.active())
+    {
+      if (!(iField = this->getField(accel.getField())))
+      {
+        std::cerr <<" *** SIMCoupledSI::solveStep: No interface field \""
+                  << accel.getField() <<"\"."<< std::endl;
+        return false;
+      }
+      accel.initStep(*iField);
+    }
+
     SIM::ConvStatus conv = SIM::OK;
     for (tp.iter = 0; tp.iter <= maxIter && conv != SIM::CONVERGED; tp.iter++)
     {
@@ -62,6 +87,17 @@ public:
 
       if ((conv = this->checkConvergence(tp,status1,status2)) <= SIM::DIVERGED)
         return false;
+
+      if (iField && conv != SIM::CONVERGED)
+      {
+        if (!accel.apply(*iField))
+          return false;
+        else if (tp.multiSteps())
+          this->S1.getProcessAdm().cout <<"  Coupling iteration "<< tp.iter+1
+                                        <<": |r| = "<< accel.getResidual()
+                                        <<"  omega = "<< accel.getOmega()
+                                        << std::endl;
+      }
     }
 
     this->S1.postSolve(tp);
@@ -88,8 +124,26 @@ public:
     return SIM::OK;
   }
 
+  //! \brief Parses the staggering acceleration from an XML element.
+  //! \param[in] elem The XML element to parse
+  //! \details The \a acceleration tag may be given directly,
+  //! or as a child of \a elem.
+  bool parse(const TiXmlElement* elem)
+  {
+    if (!strcasecmp(elem->Value(),"acceleration"))
+      return accel.parse(elem);
+
+    const TiXmlElement* child = elem->FirstChildElement("acceleration");
+    return child ? accel.parse(child) : true;
+  }
+
+  //! \brief Returns the accelerator of the staggering iterations.
+  CouplingAccelerator& getAccelerator() { return accel; }
+
 protected:
   int maxIter; //!< Maximum number of iterations
+
+  CouplingAccelerator accel; //!< Staggering iteration accelerator
 };
 
 #endif
@@ -0,0 +1,299 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SIMSolverParareal.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Parareal time-parallel SIM solver class template.
+//!
+//==============================================================================
+
+#ifndef _SIM_SOLVER_PARAREAL_H_
+#define _SIM_SOLVER_PARAREAL_H_
+
+#include "SIMSolver.h"
+#include "MatVec.h"
+#include "Utilities.h"
+#include <functional>
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+
+/*!
+  \brief Template class for Parareal time-parallel simulator drivers.
+  \details This template can be instantiated over any type implementing the
+  ISolver interface, and which stores its state in SIMsolution::theSolutions().
+  The time domain is divided into a number of slices. The coarse propagator
+  \a G is the solver \a S1 itself, advancing over each slice with a few large
+  time steps. The fine propagator \a F uses the regular time step size of the
+  \a timestepping definition, and is run concurrently for all slices using
+  independent solver instances, one per thread. The slice-interface states are
+  then updated by the Parareal correction
+  \f[ U_{n+1}^{k+1} = G(U_n^{k+1}) + F(U_n^k) - G(U_n^k) \f]
+  until the relative change in the interface states is below a tolerance.
+
+  After \a k iterations, the first \a k slices are identical to the sequential
+  fine solution. The correction is applied to all solution vectors of the
+  solver, therefore the time integration scheme should be self-starting.
+  The results are saved at the slice interfaces only.
+*/
+
+template<class T1> class SIMSolverParareal : public SIMSolver<T1>
+{
+public:
+  //! \brief Function type creating an independent solver instance.
+  //! \details The instance must be fully initialized, i.e., it should be ready
+  //! to start the time integration loop from the current solution vectors.
+  typedef std::function<T1*()> SolverFactory;
+
+  //! \brief The constructor initializes the solver instance factory.
+  //! \param s1 The solver used for the coarse propagator and for result output
+  //! \param[in] create Factory creating the solvers of the fine propagator
+  SIMSolverParareal(T1& s1, const SolverFactory& create)
+    : SIMSolver<T1>(s1), factory(create)
+  {
+    nSlices = 1;
+    nCoarse = 1;
+    maxIter = 0;
+    convTol = 1.0e-8;
+    nIter = 0;
+  }
+
+  //! \brief The destructor deletes the fine propagator solvers.
+  virtual ~SIMSolverParareal() { for (T1* s : fine) delete s; }
+
+  //! \brief Returns the number of Parareal iterations performed.
+  int getNoIterations() const { return nIter; }
+
+  //! \brief Returns the solution state at the end of each time slice.
+  const std::vector<Vectors>& getSliceStates() const { return U; }
+
+  //! \brief Defines the time slicing.
+  //! \param[in] slices Number of time slices
+  //! \param[in] coarseSteps Number of coarse time steps within each slice
+  //! \param[in] maxIt Maximum number of iterations (0: equal to \a slices)
+  //! \param[in] tol Convergence tolerance on the slice-interface states
+  void setSlices(int slices, int coarseSteps = 1, int maxIt = 0,
+                 double tol = 1.0e-8)
+  {
+    nSlices = slices > 1 ? slices : 1;
+    nCoarse = coarseSteps > 1 ? coarseSteps : 1;
+    maxIter = maxIt;
+    convTol = tol;
+  }
+
+  //! \brief Solves the problem up to the final time.
+  virtual int solveProblem(char* infile, const char* heading = nullptr,
+                           bool saveInit = true)
+  {
+    int geoBlk = 0, nBlock = 0;
+    if (!this->saveState(geoBlk,nBlock,true,infile,saveInit))
+      return 2;
+
+    this->printHeading(heading);
+
+    if (!this->solveParareal())
+      return 3;
+
+    // Save the converged slice-interface states
+    for (int n = 1; n <= nSlices; n++)
+    {
+      this->tp.step = n;
+      this->tp.time.dt = T[n] - T[n-1];
+      this->tp.time.t = T[n];
+      this->S1.theSolutions() = U[n];
+      if (!this->saveState(geoBlk,nBlock))
+        return 4;
+    }
+
+    return 0;
+  }
+
+  //! \brief Performs the Parareal iterations.
+  //! \details On entry, the solution vectors of \a S1 contain the initial state.
+  //! On exit, they contain the state at the final time.
+  bool solveParareal()
+  {
+    const double t0 = this->tp.time.t;
+    const double dtF = this->tp.time.dt;
+    const double dT = (this->tp.stopTime - t0) / nSlices;
+    if (dtF <= 0.0 || dT <= 0.0)
+    {
+      std::cerr <<" *** SIMSolverParareal: Invalid time domain ["<< t0 <<","
+                << this->tp.stopTime <<"] with dt="<< dtF << std::endl;
+      return false;
+    }
+
+    IFEM::cout <<"\n  >>> Parareal with "<< nSlices <<" time slices of size "
+               << dT <<"\n      Coarse time step size: "<< dT/nCoarse
+               <<"\n      Fine time step size:   "<< dtF << std::endl;
+
+    // Create the fine propagator solvers, one per thread
+#ifdef USE_OPENMP
+    int nThread = std::min(nSlices,omp_get_max_threads());
+#else
+    int nThread = 1;
+#endif
+    while (fine.size() < static_cast<size_t>(nThread))
+      if (T1* solver = factory())
+        fine.push_back(solver);
+      else
+      {
+        std::cerr <<" *** SIMSolverParareal: Failed to create solver."
+                  << std::endl;
+        return false;
+      }
+
+    T.resize(nSlices+1);
+    for (int n = 0; n <= nSlices; n++)
+      T[n] = n < nSlices ? t0 + n*dT : this->tp.stopTime;
+
+    // Initial coarse prediction
+    U.resize(nSlices+1);
+    G.resize(nSlices+1);
+    Fn.resize(nSlices+1);
+    U.front() = this->S1.theSolutions();
+    for (int n = 0; n < nSlices; n++)
+      if (propagate(this->S1,U[n],U[n+1],T[n],T[n+1],(T[n+1]-T[n])/nCoarse))
+        G[n+1] = U[n+1];
+      else
+        return false;
+
+    int maxIt = maxIter > 0 && maxIter < nSlices ? maxIter : nSlices;
+    for (nIter = 1; nIter <= maxIt; nIter++)
+    {
+      // Fine propagation over all non-converged slices, in parallel.
+      // Slice nIter-1 starts from an exact state, so the slices before it
+      // need no further update. The team size must not exceed the number
+      // of solvers, since each thread uses the solver of its thread number.
+      bool ok = true;
+#pragma omp parallel for schedule(dynamic) num_threads(nThread) reduction(&&:ok)
+      for (int n = nIter-1; n < nSlices; n++)
+      {
+#ifdef USE_OPENMP
+        T1* solver = fine[omp_get_thread_num()];
+#else
+        T1* solver = fine.front();
+#endif
+        ok = propagate(*solver,U[n],Fn[n+1],T[n],T[n+1],dtF) && ok;
+      }
+      if (!ok) return false;
+
+      // Sequential coarse sweep with the Parareal correction
+      double maxChange = 0.0;
+      U[nIter] = Fn[nIter];
+      for (int n = nIter; n < nSlices; n++)
+      {
+        Vectors Gnew;
+        if (!propagate(this->S1,U[n],Gnew,T[n],T[n+1],(T[n+1]-T[n])/nCoarse))
+          return false;
+
+        Vectors& u = U[n+1];
+        for (size_t i = 0; i < u.size(); i++)
+        {
+          Vector uNew(Gnew[i]);
+          uNew.add(Fn[n+1][i]).add(G[n+1][i],-1.0);
+          double uNorm = uNew.norm2();
+          u[i].add(uNew,-1.0);
+          double change = u[i].norm2();
+          if (uNorm > 1.0e-16) change /= uNorm;
+          if (change > maxChange) maxChange = change;
+          u[i].swap(uNew);
+        }
+        G[n+1].swap(Gnew);
+      }
+
+      IFEM::cout <<"  Parareal iteration "<< nIter
+                 <<": max relative change in slice states "<< maxChange
+                 << std::endl;
+      if (maxChange < convTol)
+        break;
+    }
+
+    if (nIter > maxIt)
+    {
+      nIter = maxIt;
+      if (maxIt < nSlices)
+        IFEM::cout <<"  ** Parareal did not converge in "<< maxIt
+                   <<" iterations."<< std::endl;
+    }
+
+    this->S1.theSolutions() = U.back();
+    this->tp.time.t = T.back();
+    return true;
+  }
+
+protected:
+  using SIMSolver<T1>::parse;
+  //! \brief Parses a data section from an XML element.
+  virtual bool parse(const TiXmlElement* elem)
+  {
+    if (strcasecmp(elem->Value(),"parareal"))
+      return this->SIMSolver<T1>::parse(elem);
+
+    const char* value = nullptr;
+    const TiXmlElement* child = elem->FirstChildElement();
+    for (; child; child = child->NextSiblingElement())
+      if ((value = utl::getValue(child,"slices")))
+        nSlices = std::max(atoi(value),1);
+      else if ((value = utl::getValue(child,"coarse_steps")))
+        nCoarse = std::max(atoi(value),1);
+      else if ((value = utl::getValue(child,"max_iter")))
+        maxIter = atoi(value);
+      else if ((value = utl::getValue(child,"tol")))
+        convTol = atof(value);
+
+    IFEM::cout <<"\tNumber of time slices: "<< nSlices
+               <<"\n\tNumber of coarse steps per slice: "<< nCoarse
+               <<"\n\tConvergence tolerance: "<< convTol;
+    if (maxIter > 0)
+      IFEM::cout <<"\n\tMax. number of iterations: "<< maxIter;
+    IFEM::cout << std::endl;
+    return true;
+  }
+
+  //! \brief Advances a solver over a time slice.
+  //! \param solver The solver to use
+  //! \param[in] u0 Solution state at the start of the slice
+  //! \param[out] u1 Solution state at the end of the slice
+  //! \param[in] t0 Start time of the slice
+  //! \param[in] t1 End time of the slice
+  //! \param[in] dt Time step size
+  static bool propagate(T1& solver, const Vectors& u0, Vectors& u1,
+                        double t0, double t1, double dt)
+  {
+    TimeStep ts;
+    ts.starTime = ts.time.t = t0;
+    ts.stopTime = t1;
+    ts.time.dt = dt;
+
+    solver.theSolutions() = u0;
+    while (!ts.finished() && ts.increment())
+      if (!solver.advanceStep(ts) || !solver.solveStep(ts))
+        return false;
+
+    u1 = solver.theSolutions();
+    return true;
+  }
+
+private:
+  SolverFactory   factory; //!< Creates the fine propagator solvers
+  std::vector<T1*> fine;   //!< Fine propagator solvers, one per thread
+
+  int    nSlices; //!< Number of time slices
+  int    nCoarse; //!< Number of coarse time steps within each slice
+  int    maxIter; //!< Maximum number of Parareal iterations
+  double convTol; //!< Convergence tolerance on the slice-interface states
+  int    nIter;   //!< Number of Parareal iterations performed
+
+  std::vector<double>  T;  //!< Slice-interface times
+  std::vector<Vectors> U;  //!< Current slice-interface states
+  std::vector<Vectors> G;  //!< Coarse propagation of previous iteration
+  std::vector<Vectors> Fn; //!< Fine propagation of current iteration
+};
+
+#endif
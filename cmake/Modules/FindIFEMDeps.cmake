@@ -161,7 +161,9 @@ IF(IFEM_USE_HDF5)
   endif()
   find_package(HDF5 COMPONENTS C)
   if(HDF5_FOUND)
-    SET(IFEM_DEPLIBS ${IFEM_DEPLIBS} ${HDF5_LIBRARIES})
+    # Field functions prefetch time levels in a background thread
+    FIND_PACKAGE(Threads REQUIRED)
+    SET(IFEM_DEPLIBS ${IFEM_DEPLIBS} ${HDF5_LIBRARIES} ${CMAKE_THREAD_LIBS_INIT})
     set(IFEM_DEPINCLUDES ${IFEM_DEPINCLUDES} ${HDF5_INCLUDE_DIR}
                          ${HDF5_INCLUDE_DIRS})
     SET(IFEM_BUILD_CXX_FLAGS "${IFEM_BUILD_CXX_FLAGS} -DHAS_HDF5=1")
@@ -222,6 +224,16 @@ if(IFEM_USE_UMFPACK)
   endif()
 endif()
 
+# CHOLMOD
+if(IFEM_USE_CHOLMOD)
+  find_package(SuiteSparse COMPONENTS cholmod)
+  if(SuiteSparse_CHOLMOD_FOUND)
+    list(APPEND IFEM_DEFINITIONS -DHAS_CHOLMOD=1)
+    list(APPEND IFEM_DEPINCLUDES ${CHOLMOD_INCLUDE_DIR})
+    list(APPEND IFEM_DEPLIBS ${CHOLMOD_LIBRARIES})
+  endif()
+endif()
+
 # ISTL - need to be after UMFPack and SuperLU
 if(IFEM_USE_ISTL)
   find_package(ISTL)
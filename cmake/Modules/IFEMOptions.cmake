@@ -11,6 +11,7 @@ OPTION(IFEM_USE_SAMG           "Compile with SAMG support?"           OFF)
 OPTION(IFEM_USE_HDF5           "Compile with HDF5 support?"           ON)
 OPTION(IFEM_USE_VTFWRITER      "Compile with VTFWriter support?"      ON)
 OPTION(IFEM_USE_UMFPACK        "Compile with UMFPACK support?"        ON)
+OPTION(IFEM_USE_CHOLMOD        "Compile with CHOLMOD support?"        ON)
 OPTION(IFEM_USE_CEREAL         "Compile with cereal support?"         ON)
 OPTION(IFEM_USE_ZOLTAN         "Compile with zoltan support?"         OFF)
 OPTION(IFEM_AS_SUBMODULE       "Compile IFEM as a submodule of apps?" OFF)
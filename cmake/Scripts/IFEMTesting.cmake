@@ -62,6 +62,7 @@ macro(IFEM_add_unittests IFEM_PATH)
   if(NOT HDF5_FOUND)
     list(REMOVE_ITEM TEST_SOURCES ${IFEM_PATH}/src/Utility/Test/TestFieldFunctions.C)
     list(REMOVE_ITEM TEST_SOURCES ${IFEM_PATH}/src/Utility/Test/TestFieldFunctionsLR.C)
+    list(REMOVE_ITEM TEST_SOURCES ${IFEM_PATH}/src/Utility/Test/TestTexturePropertiesHDF5.C)
   endif()
 
   if(LRSPLINE_FOUND OR LRSpline_FOUND)
@@ -28,6 +28,7 @@ typedef MPCSet::const_iterator MPCIter; //!< Iterator over an MPC equation set
 
 struct TimeDomain;
 class ElementBlock;
+class SampledBasis;
 class Field;
 class Fields;
 class GlobalIntegral;
@@ -156,6 +157,12 @@ public:
 
   //! \brief Defines the numerical integration scheme \a nGauss in the patch.
   void setGauss(int ng) { nGauss = ng; }
+  //! \brief Toggles patch-wide spline quadrature in the interior integration.
+  //! \details When enabled, tensor-product patches integrate the interior
+  //! terms with a quadrature rule that is exact for the products of the spline
+  //! basis functions over the whole patch, instead of element-wise Gauss rules.
+  //! This only applies when no reduced integration is requested.
+  void setSplineQuadrature(bool enable) { splineQuad = enable; }
 
   //! \brief Defines the number of solution fields \a nf in the patch.
   //! \details This method is to be used by simulators where \a nf is not known
@@ -429,6 +436,8 @@ public:
   virtual void generateThreadGroups(char, bool, bool) {}
   //! \brief Generate element-groups for multi-threading based on a partition.
   virtual void generateThreadGroupsFromElms(const IntVec&) {}
+  //! \brief Returns the 0-based indices of the elements in the partition.
+  const IntVec& getPartitionElms() const { return myElms; }
 
 
   // Methods for integration of finite element quantities.
@@ -596,6 +605,21 @@ public:
   virtual bool evalSolution(Matrix& sField, const IntegrandBase& integrand,
 			    const RealArray* gpar, bool regular = true) const;
 
+  //! \brief Evaluates the secondary solution field at sampled points.
+  //! \param[out] sField Solution field
+  //! \param[in] integrand Object with problem-specific data and methods
+  //! \param[in] basis Basis functions sampled at the result points
+  //!
+  //! \details This method can only be used for integrands that do not need
+  //! second derivatives of the basis functions, or the updated configuration.
+  bool evalSolution(Matrix& sField, const IntegrandBase& integrand,
+                    const SampledBasis& basis) const;
+
+  //! \brief Samples the basis functions at the given points.
+  //! \return \e false if not supported for this patch type, or on failure
+  virtual bool sampleBasis(SampledBasis&, const RealArray*,
+                           bool = false) const { return false; }
+
   //! \brief Projects the secondary solution using a (discrete) global L2-fit.
   //! \param[out] sField Secondary solution field control point values
   //! \param[in] integrand Object with problem-specific data and methods
@@ -652,6 +676,21 @@ public:
   //! \brief Checks if a separate projection basis is used for this patch.
   virtual bool separateProjectionBasis() const { return false; }
 
+  //! \brief Computes the prolongation operator of a coarsened patch basis.
+  //! \param[out] P Univariate prolongation matrix in each parameter direction
+  //! \param[in] level Index of the fine level, 0 is the patch basis itself
+  //! \param[in] pCoarsen If \e true, the first coarse level is linear
+  //! \return \e false if the basis can not be coarsened any further,
+  //! or if not supported for this patch type
+  //!
+  //! \details The prolongation operator from level \a level+1 to \a level is
+  //! the tensor product of the returned matrices, with the first parameter
+  //! direction running fastest. It is used by spline multigrid solvers.
+  //! For rational bases the weights are not accounted for, such that the
+  //! coarse spaces then only approximate a nested refinement hierarchy.
+  virtual bool getProlongation(std::vector<Matrix>& P, int level,
+                               bool pCoarsen = false) const { return false; }
+
 
   // Methods for result extraction
   // =============================
@@ -856,6 +895,7 @@ protected:
   //! If the value is set larger than 10, the number of quadrature points
   //! in each parameter direction is set to \a p+nGauss%10.
   int nGauss; //!< \sa getNoGaussPt
+  bool splineQuad; //!< If \e true, use patch-wide spline quadrature rules
 
   size_t firstIp; //!< Global index to first interior integration point
 
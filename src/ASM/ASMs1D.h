@@ -154,6 +154,13 @@ public:
   //! \brief Creates a separate projection basis for this patch.
   virtual bool createProjectionBasis(bool init);
 
+  //! \brief Computes the prolongation operator of a coarsened patch basis.
+  //! \param[out] P Univariate prolongation matrix in each parameter direction
+  //! \param[in] level Index of the fine level, 0 is the patch basis itself
+  //! \param[in] pCoarsen If \e true, the first coarse level is linear
+  virtual bool getProlongation(std::vector<Matrix>& P, int level,
+                               bool pCoarsen) const;
+
 
   // Various methods for preprocessing of boundary conditions and patch topology
   // ===========================================================================
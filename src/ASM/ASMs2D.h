@@ -18,6 +18,7 @@
 #include "ASM2D.h"
 #include "Interface.h"
 #include "ThreadGroups.h"
+#include "SampledBasis.h"
 
 namespace utl {
   class Point;
@@ -246,6 +247,13 @@ public:
   //! \brief Creates a separate projection basis for this patch.
   virtual bool createProjectionBasis(bool init);
 
+  //! \brief Computes the prolongation operator of a coarsened patch basis.
+  //! \param[out] P Univariate prolongation matrix in each parameter direction
+  //! \param[in] level Index of the fine level, 0 is the patch basis itself
+  //! \param[in] pCoarsen If \e true, the first coarse level is linear
+  virtual bool getProlongation(std::vector<Matrix>& P, int level,
+                               bool pCoarsen) const;
+
 
   // Various methods for preprocessing of boundary conditions and patch topology
   // ===========================================================================
@@ -503,6 +511,13 @@ public:
   virtual bool evalSolution(Matrix& sField, const IntegrandBase& integrand,
 			    const RealArray* gpar, bool regular = true) const;
 
+  //! \brief Samples the basis functions at the given points.
+  //! \param basis The sampled basis, only recomputed if it no longer is valid
+  //! \param[in] gpar Parameter values of the sampling points
+  //! \param[in] regular Flag indicating how the sampling points are defined
+  virtual bool sampleBasis(SampledBasis& basis, const RealArray* gpar,
+                           bool regular = false) const;
+
 protected:
 
   // Internal utility methods
@@ -600,6 +615,11 @@ protected:
   void generateThreadGroups(size_t strip1, size_t strip2,
                             bool silence, bool ignoreGlobalLM);
 
+  //! \brief Generates element groups for multi-threading of boundary integrals.
+  //! \param[in] lIndex Local index [1,4] of the boundary edge
+  //! \param[in] silence If \e true, suppress threading group outprint
+  virtual void generateThreadGroups(char lIndex, bool silence, bool);
+
   //! \brief Generates element groups from a partition.
   virtual void generateThreadGroupsFromElms(const IntVec& elms);
 
@@ -713,6 +733,13 @@ protected:
 
   //! Element groups for multi-threaded assembly
   ThreadGroups threadGroups;
+  //! Element groups for multi-threaded assembly of interface terms
+  ThreadGroups threadGroupsJump;
+  //! Element groups for multi-threaded edge assembly
+  std::map<char,ThreadGroups> threadGroupsEdge;
+
+  //! Basis functions sampled at the result points, for repeated evaluation
+  mutable SampledBasis vizBasis;
 };
 
 #endif
@@ -18,6 +18,7 @@
 #include "ASM3D.h"
 #include "Interface.h"
 #include "ThreadGroups.h"
+#include "SampledBasis.h"
 
 namespace utl {
   class Point;
@@ -269,6 +270,13 @@ public:
   //! \brief Creates a separate projection basis for this patch.
   virtual bool createProjectionBasis(bool init);
 
+  //! \brief Computes the prolongation operator of a coarsened patch basis.
+  //! \param[out] P Univariate prolongation matrix in each parameter direction
+  //! \param[in] level Index of the fine level, 0 is the patch basis itself
+  //! \param[in] pCoarsen If \e true, the first coarse level is linear
+  virtual bool getProlongation(std::vector<Matrix>& P, int level,
+                               bool pCoarsen) const;
+
 
   // Various methods for preprocessing of boundary conditions and patch topology
   // ===========================================================================
@@ -571,6 +579,13 @@ public:
   virtual bool evalSolution(Matrix& sField, const IntegrandBase& integrand,
 			    const RealArray* gpar, bool regular = true) const;
 
+  //! \brief Samples the basis functions at the given points.
+  //! \param basis The sampled basis, only recomputed if it no longer is valid
+  //! \param[in] gpar Parameter values of the sampling points
+  //! \param[in] regular Flag indicating how the sampling points are defined
+  virtual bool sampleBasis(SampledBasis& basis, const RealArray* gpar,
+                           bool regular = false) const;
+
 protected:
 
   // Internal utility methods
@@ -803,6 +818,9 @@ protected:
   ThreadGroups                threadGroupsVol;
   //! Element groups for multi-threaded face assembly
   std::map<char,ThreadGroups> threadGroupsFace;
+
+  //! Basis functions sampled at the result points, for repeated evaluation
+  mutable SampledBasis vizBasis;
 };
 
 #endif
@@ -15,6 +15,7 @@
 #define _ASM_STRUCT_H
 
 #include "ASMbase.h"
+#include <array>
 
 namespace Go {
   class GeomObject;
@@ -106,9 +107,52 @@ protected:
   //! \param[out] u Parameter values of the element borders
   virtual void getElementBorders(int iel, double* u) const = 0;
 
+  //! \brief Computes the univariate prolongation operators of a coarse level.
+  //! \param[out] P Univariate prolongation matrix in each parameter direction
+  //! \param[in] knots Knot vectors of the patch basis in each direction
+  //! \param[in] order Polynomial order of the patch basis in each direction
+  //! \param[in] level Index of the fine level, 0 is the patch basis itself
+  //! \param[in] pCoarsen If \e true, the first coarse level is linear
+  //! \return \e false if the basis can not be coarsened in any direction
+  static bool getProlongation(std::vector<Matrix>& P,
+                              const std::vector<RealArray>& knots,
+                              const IntVec& order, int level, bool pCoarsen);
+
+  //! \brief Computes a patch-wide spline quadrature rule in one direction.
+  //! \param[out] uGP Parameter values of the quadrature points in each element
+  //! \param[out] xGP Dimensionless element coordinates [-1,1] of the points
+  //! \param[out] wGP Quadrature weights, relative to the element domain [-1,1]
+  //! \param[in] dir 0-based parameter direction
+  //! \param[in] knots Knot vector of the spline basis in this direction
+  //! \param[in] p Polynomial order of the spline basis in this direction
+  //! \param[in] nGauss Number of quadrature points per element to allocate
+  //! \return \e false if no valid rule with at most \a nGauss points in any
+  //! element was found
+  //!
+  //! \details The matrices are of the same dimension as those returned by
+  //! the getGaussPointParameters methods, such that the two rules can be
+  //! used interchangeably. Unused points in an element are assigned a zero
+  //! weight, and should be skipped by the integration loop.
+  //! The univariate rule is cached for each parameter direction, and is only
+  //! recomputed when the knot vector or the polynomial order has changed.
+  bool getSplineQuadrature(Matrix& uGP, Matrix& xGP, Matrix& wGP, int dir,
+                           const RealArray& knots, int p, int nGauss);
+
 protected:
   Go::GeomObject* geomB; //!< Pointer to spline object of the geometry basis
   Go::GeomObject* projB; //!< Pointer to spline object of the projection basis
+
+private:
+  //! \brief Patch-wide spline quadrature rule in one parameter direction.
+  struct SplineRule
+  {
+    RealArray knots; //!< Knot vector that the rule is computed for
+    int       p = 0; //!< Polynomial order that the rule is computed for
+    RealArray xg;    //!< Parameter values of the quadrature points
+    RealArray wg;    //!< Quadrature weights
+  };
+
+  std::array<SplineRule,3> splineRule; //!< Cached spline quadrature rules
 };
 
 #endif
@@ -17,6 +17,7 @@
 #include "Interface.h"
 #include <map>
 #include <set>
+#include <string>
 #include <vector>
 #include <cstddef>
 
@@ -128,6 +129,17 @@ public:
   static std::vector<std::vector<int>> calcSubdomains(size_t nel1, size_t nel2, size_t nel3,
                                                       size_t g1, size_t g2, size_t g3, size_t overlap);
 
+  //! \brief Finds the elements of a refined mesh inheriting a partition.
+  //! \param[in] boxes Parameter domains of the partition elements before refinement
+  //! \param[in] midpoints Parameter midpoints of all elements after refinement
+  //! \return 0-based indices of the refined elements in the partition
+  //! \details Each refined element is contained in exactly one element of the
+  //! mesh before the refinement. It therefore belongs to the partition
+  //! if its midpoint is inside one of the \a boxes.
+  //! Each box is stored as (min,max) for each parameter direction.
+  static std::vector<int> inheritPartition(const std::vector<std::vector<double>>& boxes,
+                                           const std::vector<std::vector<double>>& midpoints);
+
   //! \brief Get first equation owned by this process.
   int getMinEq(size_t idx = 0) const { return blocks[idx].minEq; }
   //! \brief Get last equation owned by this process.
@@ -184,6 +196,23 @@ public:
   void setElms(const std::vector<int>& elms, const std::string& save)
   { myElms = elms; savePart = save; }
 
+  //! \brief Set elements in partition, inherited from a mesh refinement.
+  //! \details The partition is then retained by the next clearElms() call,
+  //! such that it is used when the refined model is preprocessed again.
+  void setRefinedElms(const std::vector<int>& elms)
+  { myElms = elms; refinedPart = true; }
+
+  //! \brief Sets the maximum imbalance of a partition inherited by refinement.
+  //! \param[in] imb Largest accepted ratio of the maximum to the average
+  //! number of elements per process
+  void setMaxImbalance(double imb) { maxImbalance = imb; }
+  //! \brief Returns the maximum imbalance of a partition inherited by refinement.
+  double getMaxImbalance() const { return maxImbalance; }
+
+  //! \brief Clears the element partition, unless inherited from a refinement.
+  void clearElms()
+  { if (!refinedPart) myElms.clear(); refinedPart = false; savePart.clear(); }
+
 private:
   //! \brief Calculates a 1D partitioning with a given overlap.
   //! \param[in] nel1 Number of knot-spans in first parameter direction.
@@ -275,6 +304,8 @@ private:
   std::vector<int> MLGN; //!< Process-local-to-global node numbers
   std::vector<BlockInfo> blocks; //!< Equation mappings for all matrix blocks.
   std::vector<int> myElms; //!< Elements in partition
+  bool refinedPart = false; //!< \e true if \a myElms is from a refinement
+  double maxImbalance = 1.2; //!< Max/average elements of refined partition
   int minDof = 0; //!< First DOF we own
   int maxDof = 0; //!< Last DOF we own
   int minNode = 0; //!< First node we own
@@ -15,6 +15,7 @@
 #define _IB_GEOMETRIES_H
 
 #include "ImmersedBoundaries.h"
+#include <cstddef>
 
 class RealFunc;
 
@@ -49,6 +50,10 @@ public:
   //! Alpha = 1.0 if the point is lying inside the physical domain
   virtual double Alpha(double X, double Y, double = 0.0) const;
 
+  //! \brief Returns the bounding box of the hole.
+  virtual void getBoundingBox(double& x0, double& y0,
+                              double& x1, double& y1) const;
+
   //! \brief Creates a finite element model of the geometry for visualization.
   virtual ElementBlock* tesselate() const;
 
@@ -74,6 +79,10 @@ public:
   //! \brief Performs the inside-outside test for the perforated plate object.
   virtual double Alpha(double X, double Y, double) const;
 
+  //! \brief Returns the bounding box of the oval hole.
+  virtual void getBoundingBox(double& x0, double& y0,
+                              double& x1, double& y1) const;
+
   //! \brief Creates a finite element model of the geometry for visualization.
   virtual ElementBlock* tesselate() const;
 
@@ -87,15 +96,19 @@ private:
 
 /*!
   \brief Class representing a plate perforated by multiple holes.
+
+  \details The holes are sorted into a uniform grid of bins covering their
+  bounding boxes when the \a initialize method is invoked, such that the
+  inside-outside test only needs to check the holes of one bin.
 */
 
 class PerforatedPlate2D : public Immersed::Geometry
 {
 public:
   //! \brief Default constructor.
-  PerforatedPlate2D() {}
+  PerforatedPlate2D() : nx(0), ny(0) {}
   //! \brief Constructor creating a single hole.
-  explicit PerforatedPlate2D(Hole2D* hole) : holes({hole}) { }
+  explicit PerforatedPlate2D(Hole2D* hole) : holes({hole}), nx(0), ny(0) {}
   //! \brief The destructor deletes the holes.
   virtual ~PerforatedPlate2D();
 
@@ -104,6 +117,9 @@ public:
   //! \brief Adds a hole to the perforated plate.
   void addHole(double r, double x0, double y0, double x1, double y1);
 
+  //! \brief Builds the spatial search index of the holes.
+  virtual void initialize();
+
   //! \brief Performs the inside-outside test for the perforated plate object.
   virtual double Alpha(double X, double Y, double) const;
 
@@ -112,6 +128,14 @@ public:
 
 private:
   std::vector<Hole2D*> holes; //!< The holes that perforate the plate
+
+  double xmin; //!< Lower X-coordinate of the search index domain
+  double ymin; //!< Lower Y-coordinate of the search index domain
+  double dx;   //!< Bin size in X-direction
+  double dy;   //!< Bin size in Y-direction
+  size_t nx;   //!< Number of bins in X-direction
+  size_t ny;   //!< Number of bins in Y-direction
+  std::vector< std::vector<size_t> > bins; //!< Hole indices of each bin
 };
 
 
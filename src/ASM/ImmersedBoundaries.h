@@ -50,6 +50,9 @@ namespace Immersed //! Utilities for immersed boundary calculations
     //! \brief Empty destructor.
     virtual ~Geometry() {}
 
+    //! \brief Prepares the object for (multi-threaded) inside-outside tests.
+    virtual void initialize() {}
+
     //! \brief Performs the inside-outside test for the geometric object.
     //! \details Alpha is used as an indicator here:
     //! Alpha = 0.0 if the point is lying outside the physical domain
@@ -88,6 +91,9 @@ namespace Immersed //! Utilities for immersed boundary calculations
   //! The coordinates returned are assumed to be referring to the bi-unit square
   //! (tri-unit cube in 3D) of each element, and the weights are standard Gauss
   //! quadrature weights, which summs to 2 in the power of number of dimensions.
+  //!
+  //! The elements are processed in parallel if \a grid is null, such that the
+  //! \a Alpha method of the geometry object then needs to be thread-safe.
   bool getQuadraturePoints(const Geometry& geo,
                            const std::vector<PointVec>& elmCorner,
                            int max_depth, int p,
@@ -122,6 +128,7 @@ namespace Immersed //! Utilities for immersed boundary calculations
   extern int stabilization; //!< Stabilization option
 
   extern bool plotCells; //!< Flags whether subcells should be plotted or not
+  extern bool compress;  //!< Flags whether to use moment fitting for cut cells
 }
 
 #endif
@@ -73,6 +73,11 @@ public:
   //! \details This method is invoked once before starting the numerical
   //! integration over the entire spatial domain.
   virtual void initIntegration(const TimeDomain&, const Vector&, bool = false){}
+  //! \brief Prepares integrand-owned functions for evaluation at time \a t.
+  //! \details This method is invoked before the element assembly of each
+  //! time step, and is reimplemented by integrands owning property functions
+  //! that are not registered in the SIMbase function containers.
+  virtual bool initTime(double) { return true; }
   //! \brief Initializes the integrand for a new result point loop.
   //! \details This method is invoked once before starting the evaluation of
   //! the secondary solution at all result sampling points, after the converged
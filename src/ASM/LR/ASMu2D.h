@@ -19,6 +19,7 @@
 #include "Interface.h"
 #include "LRSpline/LRSpline.h"
 #include "ThreadGroups.h"
+#include "SampledBasis.h"
 #include <memory>
 
 class FiniteElement;
@@ -478,6 +479,15 @@ public:
   virtual bool evalSolution(Matrix& sField, const IntegrandBase& integrand,
                             const RealArray* gpar, bool = false) const;
 
+  //! \brief Samples the basis functions at the given points.
+  //! \param basis The sampled basis, only recomputed if it no longer is valid
+  //! \param[in] gpar Parameter values of the sampling points
+  //!
+  //! \details We assume that the parameter value array \a gpar contains
+  //! the \a u and \a v parameters directly for each sampling point.
+  virtual bool sampleBasis(SampledBasis& basis, const RealArray* gpar,
+                           bool = false) const;
+
   //! \brief Projects inhomogenuous dirichlet conditions by continuous L2-fit.
   //! \param[in] edge low-level edge information needed to do integration
   //! \param[in] values inhomogenuous function which is to be fitted
@@ -612,6 +622,10 @@ protected:
   //! \param[in] ignoreGlobalLM If \e true ignore global multipliers in sanity check
   void generateThreadGroups(const Integrand& integrand, bool silence,
                             bool ignoreGlobalLM);
+  //! \brief Generates element groups for multi-threading of boundary integrals.
+  //! \param[in] lIndex Local index [1,4] of the boundary edge
+  //! \param[in] silence If \e true, suppress threading group outprint
+  virtual void generateThreadGroups(char lIndex, bool silence, bool);
 
   //! \brief Generate element groups from a partition.
   virtual void generateThreadGroupsFromElms(const std::vector<int>& elms);
@@ -663,6 +677,8 @@ protected:
 
   ThreadGroups threadGroups; //!< Element groups for multi-threaded assembly
   ThreadGroups projThreadGroups; //!< Element groups for multi-threaded assembly - projection basis
+  ThreadGroups threadGroupsJump; //!< Element groups for interface terms
+  std::map<char,ThreadGroups> threadGroupsEdge; //!< Edge element groups
 
   const Matrices& bezierExtract; //!< Bezier extraction matrices
   Matrices      myBezierExtract; //!< Bezier extraction matrices
@@ -670,6 +686,9 @@ protected:
   Go::BsplineBasis bezier_u; //!< Bezier basis in the u-direction
   Go::BsplineBasis bezier_v; //!< Bezier basis in the v-direction
 
+  //! Basis functions sampled at the result points, for repeated evaluation
+  mutable SampledBasis vizBasis;
+
 private:
   mutable double aMin; //!< Minimum element area for adaptive refinement
 };
@@ -0,0 +1,142 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SampledBasis.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Basis functions sampled at a fixed set of points.
+//!
+//==============================================================================
+
+#ifndef _SAMPLED_BASIS_H
+#define _SAMPLED_BASIS_H
+
+#include "MatVec.h"
+#include "Vec3.h"
+#include "MemoryLog.h"
+
+class FiniteElement;
+class IntegrandBase;
+
+typedef std::vector<int> IntVec; //!< General integer vector
+
+
+/*!
+  \brief Class representing the basis functions sampled at a set of points.
+
+  \details This class stores the non-zero basis function values and their
+  first derivatives with respect to the Cartesian coordinates, as a sparse
+  point-by-basis operator. It is used to speed up repeated evaluation of
+  solution fields at the same points, like the visualization grid points,
+  which otherwise requires a re-evaluation of the spline basis each time,
+  or the result points of a simulation.
+
+  The sampled basis is associated with a key, consisting of the spline
+  basis object, the parameter values of the sampling points and the control
+  point coordinates, such that it can be verified that the stored values are
+  still valid before use. Refinement or deformation of the patch, also when
+  done through another patch sharing the same spline object, will therefore
+  invalidate the sampled basis automatically.
+
+  The storage size is accounted for in the memory log, and is sampled
+  whenever the memory figures are queried.
+*/
+
+class SampledBasis
+{
+public:
+  //! \brief Default constructor.
+  SampledBasis() : basis(nullptr), ndir(0), grid(false), maxIdx(0) {}
+  //! \brief Copy constructor.
+  //! \details The memory tracker is not copied, such that the copy gets its
+  //! own tracker accounting for its own storage.
+  SampledBasis(const SampledBasis& b) : basis(b.basis), ndir(b.ndir),
+    upar(b.upar), grid(b.grid), Xn(b.Xn), maxIdx(b.maxIdx), ptr(b.ptr),
+    idx(b.idx), val(b.val), der(b.der), prm(b.prm), jac(b.jac), Xp(b.Xp) {}
+
+  //! \brief Erases all sampled basis values.
+  void clear();
+
+  //! \brief Returns the number of sampling points.
+  size_t size() const { return ptr.empty() ? 0 : ptr.size()-1; }
+  //! \brief Returns the number of stored non-zero basis function values.
+  size_t nonZeros() const { return val.size(); }
+
+  //! \brief Checks whether the sampled values match the given key.
+  //! \param[in] spline The spline basis the values are sampled from
+  //! \param[in] gpar Parameter values of the sampling points
+  //! \param[in] nDir Number of parameter directions
+  //! \param[in] Xnod Control point coordinates of the patch
+  //! \param[in] regular If \e true, \a gpar defines a tensor-product grid
+  bool matches(const void* spline, const RealArray* gpar, size_t nDir,
+               const Matrix& Xnod, bool regular) const;
+
+  //! \brief Initializes an empty sampled basis for the given key.
+  //! \param[in] spline The spline basis the values are sampled from
+  //! \param[in] gpar Parameter values of the sampling points
+  //! \param[in] nDir Number of parameter directions
+  //! \param[in] Xnod Control point coordinates of the patch
+  //! \param[in] regular If \e true, \a gpar defines a tensor-product grid
+  //! \param[in] nPoints Expected number of sampling points
+  void init(const void* spline, const RealArray* gpar, size_t nDir,
+            const Matrix& Xnod, bool regular, size_t nPoints);
+
+  //! \brief Appends a sampling point.
+  //! \details The basis function derivatives \a fe.dNdX are assumed to have
+  //! one column for each parameter direction. This also applies to
+  //! lower-dimensional patches in higher-dimensional space (shells, beams),
+  //! where \a fe.dNdX then contains the parametric derivatives.
+  //! \param[in] fe Basis function values and derivatives at the point
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[in] ip 0-based indices of the non-zero basis functions
+  void addPoint(const FiniteElement& fe, const Vec3& X, const IntVec& ip);
+
+  //! \brief Evaluates a primary solution field at all sampling points.
+  //! \param[out] sField Solution field values at the sampling points
+  //! \param[in] locSol Solution vector local to the patch
+  //! \param[in] nComp Number of field components per node
+  bool evalSolution(Matrix& sField, const Vector& locSol, size_t nComp) const;
+  //! \brief Evaluates a secondary solution field at all sampling points.
+  //! \param[out] sField Solution field values at the sampling points
+  //! \param[in] integrand Object with problem-specific data and methods
+  //! \param fe Finite element data container, with element quantities set
+  //!
+  //! \details Only integrands depending on the basis function values and
+  //! first derivatives (in the initial configuration) can use this method.
+  bool evalSolution(Matrix& sField, const IntegrandBase& integrand,
+                    FiniteElement& fe) const;
+
+  //! \brief Extracts the sampled basis at a given point.
+  //! \param[in] i 0-based sampling point index
+  //! \param fe Basis function values and derivatives at the point
+  //! \param[out] X Cartesian coordinates of the point
+  //! \param[out] ip 0-based indices of the non-zero basis functions
+  void getPoint(size_t i, FiniteElement& fe, Vec3& X, IntVec& ip) const;
+
+private:
+  //! \brief Returns the storage size (in bytes) of the sampled values.
+  size_t memorySize() const;
+
+  const void* basis; //!< The spline basis that has been sampled
+  size_t      ndir;  //!< Number of parameter directions
+  Real2DMat   upar;  //!< Parameter values of the sampling points
+  bool        grid;  //!< If \e true, \a upar defines a tensor-product grid
+  Matrix      Xn;    //!< Control point coordinates of the sampled patch
+  int         maxIdx; //!< Largest basis function index
+
+  std::vector<size_t> ptr; //!< Offsets to the first value of each point
+  IntVec              idx; //!< Basis function indices
+  RealArray           val; //!< Basis function values
+  RealArray           der; //!< Basis function derivatives
+  RealArray           prm; //!< Parameter values of each point
+  RealArray           jac; //!< Jacobian determinant at each point
+  Vec3Vec             Xp;  //!< Cartesian coordinates of each point
+
+  //! \brief Memory accounting of the sampled values
+  utl::MemTracker memory{"Sampled basis cache",[this](){return memorySize();}};
+};
+
+#endif
@@ -66,12 +66,16 @@ namespace SplineInterpolator //! Spline interpolation/projection schemes.
   //! are referred to in \a params
   //! \param[in] basis The basis of the B-spline
   //! \param[out] coefs Control point values of the generated spline curve
+  //! \param[in] nLines Number of curves to approximate.
+  //! The data points (and resulting control point values) of each curve are
+  //! stored consecutively, and the banded mass matrix is factorized only once.
   void leastsquare_approximation(const std::vector<double>& params,
 				 const std::vector<double>& paramsweights,
 				 const std::vector<double>& points,
 				 const std::vector<double>& tangent_points,
 				 const Go::BsplineBasis& basis,
-				 std::vector<double>& coefs);
+				 std::vector<double>& coefs,
+				 int nLines = 1);
 };
 
 #endif
@@ -7,7 +7,7 @@
 //!
 //! \author Knut Morten Okstad / SINTEF
 //!
-//! \brief Interface to LAPack, ARPack and SLEPc eigenvalue solvers.
+//! \brief Interface to LAPack, ARPack, SLEPc and LOBPCG eigenvalue solvers.
 //!
 //==============================================================================
 
@@ -32,13 +32,17 @@ namespace eig //! Top-level functions for invoking eigenproblem solvers.
 	     Vector& eigVal, Matrix& eigVec, int nev);
 
   //! \brief Solves the eigenvalue problem (A-lambda*B)*x = 0 using ARPACK.
+  //! \details Methods 7 and 8 use the built-in LOBPCG solver instead,
+  //! with \a ncv as the block size. Method 7 is Jacobi-preconditioned, whereas
+  //! method 8 is preconditioned by the linear solver of \a A - \a shift*B.
+  //! They require a symmetric positive definite mass matrix \a B.
   //! \param A The system stiffness matrix
   //! \param B The system mass matrix
   //! \param[out] eigVal Computed eigenvalues
   //! \param[out] eigVec Computed eigenvectors
   //! \param[in] nev Number of eigenvalues/vectors (see ARPack documentation)
   //! \param[in] ncv Number of Arnoldi vectors (see ARPack documentation)
-  //! \param[in] mode Eigensolver method (1,...5, see ARPack documentation)
+  //! \param[in] mode Eigensolver method (1,...,8, see ARPack documentation)
   //! \param[in] shift Eigenvalue shift
   bool solve(SystemMatrix* A, SystemMatrix* B,
 	     Vector& eigVal, Matrix& eigVec, int nev, int ncv,
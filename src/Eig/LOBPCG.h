@@ -0,0 +1,116 @@
+// $Id$
+//==============================================================================
+//!
+//! \file LOBPCG.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Block eigenvalue solver working on system matrix products only.
+//!
+//==============================================================================
+
+#ifndef _LOBPCG_H
+#define _LOBPCG_H
+
+#include "MatVec.h"
+
+class SystemMatrix;
+
+
+namespace eig
+{
+  /*!
+    \brief Base class for preconditioners of the LOBPCG eigensolver.
+  */
+
+  class Preconditioner
+  {
+  public:
+    //! \brief Empty destructor.
+    virtual ~Preconditioner() {}
+    //! \brief Applies the preconditioner to a residual vector.
+    //! \param r Residual vector on input, preconditioned vector on output
+    virtual bool apply(Vector& r) = 0;
+  };
+
+
+  /*!
+    \brief Jacobi preconditioner, using the diagonal of \b A - &sigma; \b B.
+    \details Only the dense and sparse matrix formats give access to the
+    diagonal. For other formats, the preconditioner is the identity.
+  */
+
+  class JacobiPC : public Preconditioner
+  {
+  public:
+    //! \brief The constructor extracts the inverted diagonal.
+    //! \param[in] A The system stiffness matrix
+    //! \param[in] B The system mass matrix (optional)
+    //! \param[in] shift Eigenvalue shift &sigma;
+    JacobiPC(const SystemMatrix* A, const SystemMatrix* B, double shift);
+    //! \brief Empty destructor.
+    virtual ~JacobiPC() {}
+
+    //! \brief Scales the residual vector with the inverted diagonal.
+    virtual bool apply(Vector& r);
+
+  private:
+    Vector invDiag; //!< The inverted matrix diagonal
+  };
+
+
+  /*!
+    \brief Preconditioner solving with the shifted matrix \b A - &sigma; \b B.
+    \details The linear solver of the matrix type is used, i.e., a direct
+    solver reuses its factorization for all residual vectors, whereas an
+    iterative solver (PETSc, ISTL) applies its configured preconditioner,
+    e.g., AMG. With only a few iterations, the latter is a cheap approximate
+    inverse that requires no factorization.
+  */
+
+  class LinSolverPC : public Preconditioner
+  {
+  public:
+    //! \brief The constructor sets up the shifted matrix.
+    //! \param[in] A The system stiffness matrix
+    //! \param[in] B The system mass matrix (optional)
+    //! \param[in] shift Eigenvalue shift &sigma;
+    LinSolverPC(const SystemMatrix* A, const SystemMatrix* B, double shift);
+    //! \brief The destructor deletes the shifted matrix.
+    virtual ~LinSolverPC();
+
+    //! \brief Solves the shifted system with the residual as right-hand-side.
+    virtual bool apply(Vector& r);
+
+  private:
+    SystemMatrix* AM;  //!< The shifted matrix
+    bool       newLHS; //!< If \e true, the matrix has not been factorized yet
+  };
+
+
+  //! \brief Solves the eigenvalue problem (A-lambda*B)*x = 0 using LOBPCG.
+  //! \details The locally optimal block preconditioned conjugate gradient
+  //! method computes the smallest eigenvalues using only matrix-vector
+  //! products with \b A and \b B, and the preconditioner, if any.
+  //! Converged eigenvectors are soft-locked, i.e., they remain in the
+  //! Rayleigh-Ritz basis but are not given new search directions.
+  //! The inner products are computed on the local vector entries only,
+  //! so the solver cannot be used for distributed (parallel) matrices.
+  //! \param A The system stiffness matrix
+  //! \param B The system mass matrix (identity if null)
+  //! \param[out] eigVal Computed eigenvalues
+  //! \param[out] eigVec Computed eigenvectors, normalized to unit \b B-norm
+  //! \param[in] nev Number of eigenvalues/vectors to compute
+  //! \param[in] blockSize Number of vectors in the iteration block
+  //! \param[in] prec Preconditioner (optional)
+  //! \param[in] tol Relative residual tolerance
+  //! \param[in] maxIt Maximum number of iterations
+  bool solveLOBPCG(const SystemMatrix* A, const SystemMatrix* B,
+                   Vector& eigVal, Matrix& eigVec, int nev, int blockSize,
+                   Preconditioner* prec = nullptr,
+                   double tol = 1.0e-8, int maxIt = 1000);
+}
+
+#endif
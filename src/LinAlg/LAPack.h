@@ -34,6 +34,14 @@ Subroutine dgesv (int n, int nrhs,
                   Real* B, int ldb, int& info)
 { dgesv_(&n,&nrhs,A,&lda,ipiv,B,&ldb,&info); }
 
+//! \brief Solves the banded linear equation system \a A*x=b.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+Subroutine dgbsv (int n, int kl, int ku, int nrhs,
+                  Real* AB, int ldab, int* ipiv,
+                  Real* B, int ldb, int& info)
+{ dgbsv_(&n,&kl,&ku,&nrhs,AB,&ldab,ipiv,B,&ldb,&info); }
+
 //! \brief Computes an LU factorization of a general M-by-N matrix A.
 //! \details This is a FORTRAN-77 subroutine in the LAPack library.
 //! \sa LAPack library documentation.
@@ -77,6 +85,13 @@ Subroutine dpotrs (char uplo, int n, int nrhs,
                    Real* A, int lda, Real* B, int ldb, int& info)
 { dpotrs_(&uplo,&n,&nrhs,A,&lda,B,&ldb,&info); }
 
+//! \brief Solves the symmetric banded linear equation system \a A*x=b.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+Subroutine dpbsv (char uplo, int n, int kd, int nrhs,
+                  Real* AB, int ldab, Real* B, int ldb, int& info)
+{ dpbsv_(&uplo,&n,&kd,&nrhs,AB,&ldab,B,&ldb,&info); }
+
 //! \brief Solves the standard eigenproblem \a A*x=(lambda)*x.
 //! \details This is a FORTRAN-77 subroutine in the LAPack library.
 //! \sa LAPack library documentation.
@@ -122,6 +137,7 @@ Subroutine dgeev (char jobvl, char jobvr,
 
 #if defined(_WIN32) && !defined(__MINGW32__) && !defined(__MINGW64__)
 #define dgecon_ DGECON
+#define dgbsv_  DGBSV
 #define dgesv_  DGESV
 #define dgetrf_ DGETRF
 #define dgetri_ DGETRI
@@ -129,12 +145,14 @@ Subroutine dgeev (char jobvl, char jobvr,
 #define dlange_ DLANGE
 #define dposv_  DPOSV
 #define dpotrs_ DPOTRS
+#define dpbsv_  DPBSV
 #define dsyev_  DSYEV
 #define dsyevx_ DSYEVX
 #define dsygvx_ DSYGVX
 #define dgeev_  DGEEV
 #elif defined(_AIX)
 #define dgecon_ dgecon
+#define dgbsv_  dgbsv
 #define dgesv_  dgesv
 #define dgetrf_ dgetrf
 #define dgetri_ dgetri
@@ -142,6 +160,7 @@ Subroutine dgeev (char jobvl, char jobvr,
 #define dlange_ dlange
 #define dposv_  dposv
 #define dpotrs_ dpotrs
+#define dpbsv_  dpbsv
 #define dsyev_  dsyev
 #define dsyevx_ dsyevx
 #define dsygvx_ dsygvx
@@ -162,6 +181,13 @@ void dgesv_(const int& n, const int& nrhs,
             Real* A, const int& lda, int* ipiv,
             Real* B, const int& ldb, int& info);
 
+//! \brief Solves the banded linear equation system \a A*x=b.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+void dgbsv_(const int& n, const int& kl, const int& ku, const int& nrhs,
+            Real* AB, const int& ldab, int* ipiv,
+            Real* B, const int& ldb, int& info);
+
 //! \brief Computes an LU factorization of a general M-by-N matrix A.
 //! \details This is a FORTRAN-77 subroutine in the LAPack library.
 //! \sa LAPack library documentation.
@@ -199,6 +225,12 @@ void dposv_(const char& uplo, const int& n, const int& nrhs,
 void dpotrs_(const char& uplo, const int& n, const int& nrhs,
              Real* A, const int& lda, Real* B, const int& ldb, int& info);
 
+//! \brief Solves the symmetric banded linear equation system \a A*x=b.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+void dpbsv_(const char& uplo, const int& n, const int& kd, const int& nrhs,
+            Real* AB, const int& ldab, Real* B, const int& ldb, int& info);
+
 //! \brief Solves the standard eigenproblem \a A*x=(lambda)*x.
 //! \details This is a FORTRAN-77 subroutine in the LAPack library.
 //! \sa LAPack library documentation.
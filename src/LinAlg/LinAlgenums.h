@@ -27,7 +27,8 @@ namespace LinAlg //! Linear algebra scope
     PETSC   = 4, //!< Sparse matrices / PETSc solver
     ISTL    = 5, //!< Sparse matrices / Dune solver
     UMFPACK = 6, //!< Sparse matrices / UmfPack solver
-    DIAG    = 7  //!< Diagonal matrices / Trivial solver
+    DIAG    = 7, //!< Diagonal matrices / Trivial solver
+    SPLINE_MG = 8 //!< Sparse matrices / Spline multigrid solver
   };
 
   //! \brief Enum defining linear system properties.
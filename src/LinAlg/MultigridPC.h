@@ -0,0 +1,167 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MultigridPC.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Geometric multigrid preconditioner with given transfer operators.
+//!
+//==============================================================================
+
+#ifndef _MULTIGRID_PC_H
+#define _MULTIGRID_PC_H
+
+#include "SparseMatrix.h"
+
+class DenseMatrix;
+class LinSolParams;
+
+
+/*!
+  \brief Multigrid preconditioned conjugate gradient solver.
+
+  \details The grid hierarchy is defined by a sequence of prolongation
+  operators \f${\bf P}_l\f$, each mapping the coefficients of level \a l+1
+  onto those of the next finer level \a l, where level 0 is the system matrix.
+  For spline discretizations these operators are exact (knot insertion or
+  degree elevation), such that no geometric information is needed here.
+  The coarse level operators are the Galerkin products
+  \f${\bf A}_{l+1} = {\bf P}_l^T {\bf A}_l {\bf P}_l\f$,
+  and the coarsest one is factorized by a dense Cholesky solver.
+
+  One symmetric V-cycle is used as preconditioner in the conjugate gradient
+  method, so the system matrix should be symmetric and positive definite.
+
+  For splines of high continuity, the Jacobi and Gauss-Seidel smoothers
+  deteriorate with increasing polynomial degree, whereas the ILU(0) smoother
+  gives iteration counts nearly independent of both the mesh size and the
+  degree. The latter is therefore the smoother to use for such bases.
+  Dedicated spline smoothers, e.g., subspace corrections based on the
+  tensor-product structure of the patches, are not implemented, since this
+  class only sees the assembled matrices.
+*/
+
+class MultigridPC
+{
+public:
+  //! \brief Available smoothers.
+  enum Smoother { JACOBI, GAUSS_SEIDEL, ILU };
+
+  //! \brief The default constructor initializes the solver parameters.
+  MultigridPC();
+  //! \brief The copy constructor copies the settings and the prolongations.
+  //! \details The coarse level operators are not copied.
+  MultigridPC(const MultigridPC& pc);
+  //! \brief No assignment of this class.
+  MultigridPC& operator=(const MultigridPC&) = delete;
+  //! \brief The destructor frees the coarse level factorization.
+  ~MultigridPC();
+
+  //! \brief Sets the solver parameters from the linear solver settings.
+  //! \details The multigrid settings are taken from the first block.
+  void setParameters(const LinSolParams& spar);
+  //! \brief Sets the smoother and the number of smoothing sweeps.
+  void setSmoother(Smoother s, int nsweep = 1);
+  //! \brief Sets the convergence criteria of the conjugate gradient method.
+  void setTolerances(Real rtol, Real atol = Real(0), int maxIter = 1000);
+
+  //! \brief Defines the grid hierarchy through the prolongation operators.
+  //! \param[in] P Prolongation operators, starting at the finest level
+  //! \return \e false if the operator dimensions are inconsistent
+  bool setProlongations(const std::vector<SparseMatrix>& P);
+  //! \brief Returns the prolongation operators.
+  const std::vector<SparseMatrix>& getProlongations() const { return prolong; }
+
+  //! \brief Sets up the coarse level operators and smoothers.
+  //! \param[in] n Number of equations
+  //! \param[in] IA Start index of each row (1-based)
+  //! \param[in] JA Column index of each nonzero element (1-based)
+  //! \param[in] A The nonzero matrix elements, with the diagonal term first
+  //!
+  //! \details The matrix is referred to, not copied, and must therefore not
+  //! be changed or deleted until this method is invoked once more.
+  bool setup(size_t n, const IntVec& IA, const IntVec& JA, const Vector& A);
+
+  //! \brief Applies one V-cycle to the residual \b r, giving the correction.
+  void apply(const Real* r, Real* z) const;
+
+  //! \brief Solves the linear system of equations for a given right-hand-side.
+  //! \param[in] b The right-hand-side vector
+  //! \param x Initial guess on input, solution vector on output
+  bool solve(const Vector& b, Vector& x) const;
+
+  //! \brief Returns the number of levels in the current hierarchy.
+  size_t getNoLevels() const { return levels.size(); }
+  //! \brief Returns the number of iterations used in the last solve.
+  int getIterations() const { return nIter; }
+
+private:
+  //! \brief Sparse matrix in 1-based compressed row format.
+  struct CSR
+  {
+    size_t nrow = 0;      //!< Number of rows
+    size_t ncol = 0;      //!< Number of columns
+    const int* IA = nullptr; //!< Start index of each row
+    const int* JA = nullptr; //!< Column index of each nonzero element
+    const Real* A = nullptr; //!< The nonzero matrix elements
+    IntVec    iaStore; //!< Row start storage, if owned by this object
+    IntVec    jaStore; //!< Column index storage, if owned by this object
+    RealArray aStore;  //!< Matrix element storage, if owned by this object
+
+    //! \brief Points the array pointers to the owned storage.
+    void own();
+    //! \brief Performs the matrix-vector multiplication \b y = \b M \b x.
+    void multiply(const Real* x, Real* y) const;
+    //! \brief Stores the transpose of this matrix in \a T.
+    void transpose(CSR& T) const;
+    //! \brief Stores the product \a *this * \b B in \a C.
+    //! \param[in] B The matrix to multiply with
+    //! \param[out] C The matrix product
+    //! \param[in] diagFirst If \e true, put the diagonal term first in each row
+    void product(const CSR& B, CSR& C, bool diagFirst) const;
+  };
+
+  //! \brief Data associated with each level of the hierarchy.
+  struct Level
+  {
+    CSR A; //!< The level operator, with the diagonal term first in each row
+    CSR P; //!< Prolongation from the next coarser level
+    CSR R; //!< Restriction to the next coarser level (transpose of \a P)
+    RealArray LU; //!< Incomplete factors, in the sparsity pattern of \a A
+    mutable RealArray b; //!< Right-hand-side work vector
+    mutable RealArray x; //!< Solution work vector
+    mutable RealArray r; //!< Residual work vector
+  };
+
+  //! \brief Computes the incomplete LU-factors of a level operator.
+  static bool factorILU(Level& lev);
+  //! \brief Performs one smoothing sweep on the given level.
+  //! \param[in] lev The level to smooth on
+  //! \param[in] b The right-hand-side vector
+  //! \param x The current iterate, updated on output
+  //! \param[in] forward If \e false, traverse the equations in reverse order
+  void smooth(const Level& lev, const Real* b, Real* x, bool forward) const;
+  //! \brief Performs a V-cycle from level \a l with zero initial guess.
+  void cycle(size_t l, const Real* b, Real* x) const;
+
+  std::vector<SparseMatrix> prolong; //!< The prolongation operators
+  std::vector<Level>        levels;  //!< The grid hierarchy
+
+  DenseMatrix*      coarse;  //!< Factorized coarsest level operator
+  mutable StdVector coarseB; //!< Right-hand-side vector for the coarse solver
+
+  Smoother smoother; //!< The smoother to use
+  int      nSmooth;  //!< Number of pre- and post-smoothing sweeps
+  Real     omega;    //!< Damping factor for the Jacobi smoother
+  Real     relTol;   //!< Relative residual tolerance
+  Real     absTol;   //!< Absolute residual tolerance
+  int      maxIt;    //!< Maximum number of iterations
+  int      verbose;  //!< Verbosity level
+
+  mutable int nIter; //!< Number of iterations used in the last solve
+};
+
+#endif
@@ -181,6 +181,13 @@ protected:
   //! \brief Solve a linear system
   bool solve(const Vec& b, Vec& x, bool newLHS, bool knoll);
 
+  //! \brief Sets up a geometric multigrid preconditioner.
+  //! \details The interpolation operators are the prolongations of the
+  //! spline refinement hierarchy, and the coarse operators are computed by
+  //! PETSc as Galerkin products. This is supported in serial runs only.
+  //! \param pc The preconditioner to set up
+  void setupSplineMG(PC& pc);
+
   //! \brief Solve system stored in the elem map.
   //! \details Create matrix from elem table, and solve for (possibly) multiple
   //!          right-hand-side vectors in B.
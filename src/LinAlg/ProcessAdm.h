@@ -133,6 +133,11 @@ public:
   //! \param vec Double array to be reduced
   //! \param[in] oper MPI operator (MPI_MIN, MPI_MAX, MPI_SUM, MPI_PROD, etc.)
   void allReduce(std::vector<double>& vec, MPI_Op oper) const;
+
+  //! \brief AllGather for integer vectors of varying length.
+  //! \param ivec Local integer array on input, the concatenated arrays of all
+  //! processes (in process order) on output
+  void allGather(std::vector<int>& ivec) const;
 #endif
 
   //! \brief AllReduce with MPI_SUM for a vector.
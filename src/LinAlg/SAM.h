@@ -55,7 +55,20 @@ public:
   //! \brief Returns the total number of constraint equations in the model.
   int getNoConstraints() const { return nceq; }
   //! \brief Returns the number of equations (free DOFs) in the model.
+  //! \details This includes the Lagrange multipliers, if any.
   int getNoEquations() const { return neq; }
+  //! \brief Returns the number of Lagrange multiplier equations in the model.
+  int getNoMultipliers() const { return mlag.size(); }
+
+  //! \brief Sets the maximum number of master DOFs in eliminated constraints.
+  //! \details Constraint equations with more master DOFs than \a n are
+  //! enforced through Lagrange multipliers instead of being eliminated,
+  //! since the elimination couples all the master DOFs in the system matrix.
+  //! A zero value (default) means that all constraints are eliminated.
+  //! The multiplier constraints are supported for linear solutions only,
+  //! see assembleMultipliers(SystemVector&).
+  //! Must be invoked before initSystemEquations() to have any effect.
+  void setMaxMasters(int n) { maxMst = n; }
   //! \brief Returns the equations numbers for a given DOF type.
   //! \param[in] dType The DOF type to consider
   //! \param[in] dof The local DOF in each node to consider (0 = all)
@@ -167,6 +180,24 @@ public:
   //! \param[in] S  The global load vector
   void addToRHS(SystemVector& sysRHS, const RealArray& S) const;
 
+  //! \brief Adds the Lagrange multiplier constraint terms into a system matrix.
+  //! \param sysK The left-hand-side system matrix
+  //! \return \e true on successful assembly, otherwise \e false
+  //!
+  //! \details Must be invoked after the element assembly, since the element
+  //! matrices do not contain these terms. The constraint equations are added
+  //! in symmetric saddle-point form, such that the solver must be able to
+  //! handle the zero diagonal of the multiplier equations.
+  bool assembleMultipliers(SystemMatrix& sysK) const;
+  //! \brief Inserts the constant terms of the Lagrange multiplier constraints.
+  //! \param sysRHS The right-hand-side system load vector
+  //!
+  //! \details The constant term \a c0 is inserted as is, and no
+  //! \f${\bf B}^T\lambda\f$ term is added to the regular equations.
+  //! This is only valid when solving for the total solution of a linear
+  //! problem, and not for incremental (nonlinear or time-dependent) solutions.
+  void assembleMultipliers(SystemVector& sysRHS) const;
+
   //! \brief Finds the matrix of nodal point correspondance for an element.
   //! \param[out] mnpc Matrix of nodal point correspondance
   //! \param[in] iel Identifier for the element to get the node numbers for
@@ -337,6 +368,9 @@ protected:
   std::vector<char> nodeType; //!< Nodal DOF classification
   std::vector<char> dof_type; //!< Individual DOF classification
 
+  int    maxMst; //!< Maximum number of masters in eliminated constraints
+  IntVec mlag;   //!< Constraint equations enforced by Lagrange multipliers
+
   friend class DenseMatrix;
   friend class SPRMatrix;
   friend class SparseMatrix;
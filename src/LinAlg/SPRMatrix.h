@@ -16,6 +16,7 @@
 #define _SPR_MATRIX_H
 
 #include "SystemMatrix.h"
+#include "MemoryLog.h"
 
 //! \brief Size of the MSPAR array.
 #define NS 60
@@ -106,6 +107,9 @@ public:
   virtual Real Linfnorm() const;
 
 private:
+  //! \brief Registers the current storage size in the memory log.
+  void trackMemory();
+
   int mpar[NS] = {};      //!< Matrix of sparse PARameters
   int* msica = nullptr;   //!< Matrix of Storage Information for CA
   int* msifa = nullptr;   //!< Matrix of Storage Information for FA
@@ -115,6 +119,8 @@ private:
 
   std::vector<int>  iWork; //!< Integer work array
   std::vector<Real> rWork; //!< Real work array
+
+  utl::MemTracker memSPR{"SPR matrix"}; //!< Memory accounting of the arrays
 };
 
 #endif
@@ -15,6 +15,7 @@
 #define _SPARSE_MATRIX_H
 
 #include "SystemMatrix.h"
+#include "MemoryLog.h"
 #include <iostream>
 #include <map>
 #include <set>
@@ -25,6 +26,9 @@ typedef std::map<IJPair,Real>    ValueMap;  //!< Index to matrix value mapping
 typedef ValueMap::const_iterator ValueIter; //!< Iterator over matrix elements
 
 struct SuperLUdata;
+struct SuperLUfloat;
+struct CholmodData;
+class MultigridPC;
 
 
 /*!
@@ -32,14 +36,20 @@ struct SuperLUdata;
   \details The sparse matrix is editable in the sense that non-zero entries may
   be added at arbitrary locations. The class comes with methods for solving a
   linear system of equations based on the current matrix and a given RHS-vector,
-  using either the commercial SAMG package or the public domain SuperLU package.
+  using either the commercial SAMG package, the public domain SuperLU package,
+  or a multigrid preconditioned conjugate gradient solver based on spline
+  refinement hierarchies.
+
+  Symmetric matrices (see setSymmetric) may be stored by their upper triangle
+  only, when using the column-oriented format of the SuperLU and UMFPACK
+  solvers. Such matrices are then factorized by CHOLMOD, if available.
 */
 
 class SparseMatrix : public SystemMatrix
 {
 public:
   //! \brief Available equation solvers for this matrix type.
-  enum SparseSolver { NONE, SUPERLU, S_A_M_G, UMFPACK };
+  enum SparseSolver { NONE, SUPERLU, S_A_M_G, UMFPACK, SPLINE_MG };
 
   //! \brief Default constructor creating an empty matrix.
   SparseMatrix(SparseSolver eqSolver = NONE, int nt = 1);
@@ -85,6 +95,8 @@ public:
   virtual size_t dim(int idim = 1) const;
 
   //! \brief Index-1 based element access.
+  //! \details If only the upper triangle is stored, an element below the
+  //! diagonal refers to its transposed counterpart.
   Real& operator()(size_t r, size_t c);
   //! \brief Index-1 based element reference.
   const Real& operator()(size_t r, size_t c) const;
@@ -92,6 +104,29 @@ public:
   //! \brief For traversal of the non-zero elements of an editable matrix.
   const ValueMap& getValues() const { return elem; }
 
+  //! \brief Toggles single-precision factorization for the SuperLU solver.
+  //! \details The solution is then refined iteratively in double precision,
+  //! with automatic fallback to a double-precision factorization if the
+  //! refinement does not converge.
+  void setMixedPrecision(bool mixed) { mixedPrec = mixed; }
+
+  //! \brief Defines the symmetry properties of the matrix.
+  //! \details For symmetric matrices with the SuperLU or UMFPACK solvers,
+  //! only the upper triangle is stored, and the linear system is solved by a
+  //! Cholesky (SPD) or LDL<sup>T</sup> factorization instead. The matrix is
+  //! expanded to full storage using the general solver, if the symmetric
+  //! factorization is not available or fails. Erases the matrix content.
+  //! The element matrices are checked for symmetry when INDEX_CHECK is set.
+  void setSymmetric(LinAlg::LinearSystemType ltype);
+  //! \brief Returns \e true if only the upper triangle is stored.
+  bool isSymmetric() const { return upperOnly; }
+
+  //! \brief Defines the grid hierarchy of the multigrid solver.
+  //! \param[in] P Prolongation operators, starting at the finest level
+  bool setProlongations(const std::vector<SparseMatrix>& P);
+  //! \brief Returns the multigrid solver of this matrix, if any.
+  MultigridPC* getMultigrid() const { return mg; }
+
   //! \brief Print sparsity pattern - for inspection purposes.
   void printSparsity(std::ostream& os) const;
 
@@ -247,17 +282,53 @@ protected:
   //! \param[out] rcond Reciprocal condition number of the LHS-matrix (optional)
   bool solveSLUx(Vector& B, Real* rcond);
 
+  //! \brief Invokes the SuperLU solver with a single-precision factorization.
+  //! \param B Right-hand-side vector on input, solution vector on output
+  //! \return 1 on success, 0 if the iterative refinement did not converge
+  //! (\a B is then unchanged), or -1 on other failures
+  int solveSLUmixed(Vector& B);
+
+  //! \brief Computes the single-precision LU-factorization of the matrix.
+  //! \details The matrix must be in column-oriented format.
+  bool factorSLUfloat();
+  //! \brief Solves for a right-hand-side using the single-precision factors.
+  //! \param B Right-hand-side vector on input, solution vector on output
+  bool solveSLUfloat(Real* B) const;
+  //! \brief Frees the single-precision factorization.
+  void freeSLUfloat();
+
   //! \brief Invokes the UMFPACK equation solver for a given right-hand-side.
   //! \param B Right-hand-side vector on input, solution vector on output
   //! \param[out] rcond Reciprocal condition number of the LHS-matrix (optional)
   bool solveUMF(Vector& B, Real* rcond);
 
+  //! \brief Invokes the CHOLMOD equation solver for a given right-hand-side.
+  //! \details The matrix must be stored by its upper triangle only.
+  //! \param B Right-hand-side vector on input, solution vector on output
+  //! \param[out] rcond Reciprocal condition number of the LHS-matrix (optional)
+  //! \return 1 on success, 0 if the symmetric factorization is not available
+  //! or failed (\a B is then unchanged), or -1 on other failures
+  int solveCHOLMOD(Vector& B, Real* rcond);
+
+  //! \brief Expands an upper-triangle matrix to full storage.
+  //! \details The matrix is in the column-oriented format afterwards,
+  //! and will thereafter be treated as a general (non-symmetric) matrix.
+  void expandSymmetric();
+
+  //! \brief Invokes the multigrid solver for a given right-hand-side.
+  //! \param B Right-hand-side vector on input, solution vector on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  bool solveMG(Vector& B, bool newLHS);
+
   //! \brief Writes the system matrix to the given output stream.
   virtual std::ostream& write(std::ostream& os) const;
 
   //! \brief Returns the L-infinity norm of the matrix.
   virtual Real Linfnorm() const;
 
+  //! \brief Registers the current storage size in the memory log.
+  void trackMemory();
+
 public:
   static bool printSLUstat; //!< Print solution statistics for SuperLU?
 
@@ -276,9 +347,22 @@ private:
   SparseSolver solver; //!< Which equation solver to use
   SuperLUdata*    slu; //!< Matrix data for the SuperLU equation solver
   int      numThreads; //!< Number of threads to use for the SuperLU_MT solver
+  MultigridPC*     mg; //!< Grid hierarchy for the spline multigrid solver
+  SuperLUfloat*  sluf; //!< Single-precision factors for the SuperLU solver
+  bool      mixedPrec; //!< If \e true, use a single-precision factorization
+  CholmodData*   chol; //!< Matrix factors for the CHOLMOD solver
+
+  LinAlg::LinearSystemType linSys; //!< Symmetry properties of the matrix
+  bool upperOnly; //!< If \e true, only the upper triangle is stored
+
+  //! Memory accounting of the editable matrix elements
+  utl::MemTracker memElem{"Sparse matrix (editable)"};
+  //! Memory accounting of the compressed matrix storage
+  utl::MemTracker memCSR{"Sparse matrix (compressed)"};
 
 #ifdef HAS_UMFPACK
   void* umfSymbolic; //!< Symbolically factored matrix for UMFPACK
+  utl::MemTracker memUMF{"UMFPACK factors"}; //!< Memory accounting of factors
 #endif
 
 protected:
@@ -15,6 +15,7 @@
 #define _ADAPTIVE_SETUP_H
 
 #include "MatVec.h"
+#include <functional>
 
 class SIMoutput;
 class TiXmlElement;
@@ -59,6 +60,18 @@ public:
   int calcRefinement(LR::RefineData& prm, int iStep,
                      const Vectors& gNorm, const Vector& refIn) const;
 
+  //! \brief Finds the error threshold for distributed errors by bisection.
+  //! \param[in] error Element errors of this process, in decreasing order
+  //! \param[in] globalSum Function returning the sum over all processes
+  //! \param[in] useSum If \e true, the threshold is based on the error sum,
+  //! otherwise on the number of errors
+  //! \param[in] target The error sum or count to be reached
+  //! \param[in] lo Lower bound of the threshold
+  //! \param[in] hi Upper bound of the threshold
+  static double findThreshold(const std::vector< std::pair<double,int> >& error,
+                              const std::function<double(double)>& globalSum,
+                              bool useSum, double target, double lo, double hi);
+
   //! \brief Parses a data section from an input stream.
   //! \param[in] keyWord Keyword of current data section to read
   //! \param is The file stream to read from
@@ -45,6 +45,8 @@ public:
   virtual bool inDomain(const Vec3& X) const;
   //! \brief Returns \e true if current patch is affected by this function.
   virtual bool initPatch(size_t idx);
+  //! \brief Prepares all function components for evaluation at given time.
+  virtual bool initTime(double t);
 
   //! \brief Returns the function value as an array.
   virtual std::vector<double> getValue(const Vec3& X) const;
@@ -53,7 +53,14 @@ protected:
   //! \brief Updates configuration variables (solution vector) in an iteration.
   virtual bool correctStep(TimeStep& param, bool converged);
 
+  //! \brief Returns the matrix coefficients of the effective Newton matrix.
+  virtual bool getNewtonCoeffs(double dt,
+                               double& cM, double& cC, double& cK) const;
+
 private:
+  //! \brief Computes the intermediate solution at step \a n+alpha.
+  void intermediateSolution(bool fromSolution);
+
   double alpha_m;  //!< Generalized-alpha parameter
   double alpha_f;  //!< Generalized-alpha parameter
   Vectors prevSol; //!< Solution of last converged time step
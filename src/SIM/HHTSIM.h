@@ -220,6 +220,12 @@ protected:
   //! \brief Finalizes the right-hand-side vector on the system level.
   virtual void finalizeRHSvector(bool predicting);
 
+  //! \brief The assemble-once method for linear problems is not supported.
+  //! \details The HHT right-hand-side vector depends on the actual inertia
+  //! forces of the previous step, which are computed on the element level.
+  virtual bool getNewtonCoeffs(double, double&, double&, double&) const
+  { return false; }
+
 private:
   unsigned short int pA; //!< Index to predicted acceleration vector
   unsigned short int pV; //!< Index to predicted velocity vector
@@ -214,6 +214,12 @@ protected:
   //! \brief Finalizes the right-hand-side vector on the system level.
   virtual void finalizeRHSvector(bool);
 
+  //! \brief The assemble-once method for linear problems is not supported.
+  //! \details The right-hand-side vector depends on the actual inertia forces
+  //! of the previous step, which are added in finalizeRHSvector().
+  virtual bool getNewtonCoeffs(double, double&, double&, double&) const
+  { return false; }
+
 private:
   unsigned short int iA; //!< Index to corrected acceleration vector
   unsigned short int iV; //!< Index to corrected velocity vector
@@ -16,9 +16,19 @@
 
 #include "MultiStepSIM.h"
 
+class SystemMatrix;
+class SystemVector;
+
 
 /*!
   \brief Newmark-based solution driver for dynamic isogeometric FEM simulators.
+
+  \details For linear problems with constant mass, damping and stiffness,
+  the driver can be told (through the \a linear input flag) to assemble the
+  mass and stiffness matrices, and the effective Newton matrix, only once.
+  The Newton matrix is then factorized only once (for each time step size),
+  and the right-hand-side vector of each iteration is formed by sparse
+  matrix-vector products, plus the external load vector of current time.
 */
 
 class NewmarkSIM : public MultiStepSIM
@@ -26,8 +36,8 @@ class NewmarkSIM : public MultiStepSIM
 public:
   //! \brief The constructor initializes default solution parameters.
   explicit NewmarkSIM(SIMbase& sim);
-  //! \brief Empty destructor.
-  virtual ~NewmarkSIM() {}
+  //! \brief The destructor frees the system matrices of linear problems.
+  virtual ~NewmarkSIM();
 
   using MultiStepSIM::parse;
   //! \brief Parses a data section from an XML document.
@@ -74,6 +84,28 @@ protected:
   //! \brief Finalizes the right-hand-side vector on the system level.
   virtual void finalizeRHSvector(bool) {}
 
+  //! \brief Returns the matrix coefficients of the effective Newton matrix.
+  //! \param[in] dt Time step size
+  //! \param[out] cM Mass matrix coefficient
+  //! \param[out] cC Damping matrix coefficient
+  //! \param[out] cK Stiffness matrix coefficient
+  //! \return \e false if the residual of this integrator is not on the form
+  //! R = F - K*u - C*v - M*a (linear problems cannot be solved by the
+  //! assemble-once method then)
+  virtual bool getNewtonCoeffs(double dt,
+                               double& cM, double& cC, double& cK) const;
+
+private:
+  //! \brief Assembles and solves the linearized system of current iteration.
+  //! \param[in] time Parameters for time-dependent simulations
+  //! \param[in] predicting If \e true, this is the predictor step
+  bool assembleAndSolve(const TimeDomain& time, bool predicting);
+  //! \brief Assembles the mass and stiffness matrices of a linear problem.
+  bool initLinear();
+  //! \brief Forms the right-hand-side vector of a linear problem.
+  //! \param[in] time Parameters for time-dependent simulations
+  bool linearResidual(const TimeDomain& time);
+
 public:
   //! \brief Returns a const reference to current velocity vector.
   const Vector& getVelocity() const { return solution[solution.size()-2]; }
@@ -105,9 +137,19 @@ protected:
   double rTol;      //!< Relative convergence tolerance
   double aTol;      //!< Absolute convergence tolerance
   double divgLim;   //!< Relative divergence limit
+  bool   linear;    //!< If \e true, assemble the system matrices only once
 
   unsigned short int cNorm; //!< Option for which convergence norm to use
 
+private:
+  SystemMatrix* Mlin;    //!< Mass matrix of the linear problem
+  SystemMatrix* Klin;    //!< Stiffness matrix of the linear problem
+  SystemMatrix* Nlin;    //!< Unfactorized effective Newton matrix
+  SystemVector* Flin;    //!< External load vector at time \a linTime
+  double        linDt;   //!< Time step size of the factorized Newton matrix
+  double        linTime; //!< Time of the external load vector \a Flin
+  Vectors       zeroSol; //!< Zero solution, for assembly of external loads
+
 public:
   static const char* inputContext; //!< Input file context for solver parameters
 };
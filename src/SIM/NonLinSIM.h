@@ -16,12 +16,18 @@
 
 #include "MultiStepSIM.h"
 
+class SystemVector;
+
 
 /*!
   \brief Nonlinear quasi-static solution driver for isogeometric FEM simulators.
   \details This class contains data and methods for computing the nonlinear
   solution to a quasi-static FE problem based on splines/NURBS basis functions,
   through Newton-Raphson iterations.
+
+  Optionally, the load level is treated as an unknown and the equilibrium path
+  is followed by the arc-length method of Crisfield, which allows tracing
+  the response through limit points and snap-through.
 */
 
 class NonLinSIM : public MultiStepSIM
@@ -69,6 +75,9 @@ public:
                                     double zero_tolerance = 1.0e-8,
                                     std::streamsize outPrec = 0);
 
+  //! \brief Returns the load level of the last converged arc-length step.
+  double getLoadFactor() const { return lambda; }
+
   //! \brief Solves the linearized system of current iteration.
   //! \param[in] param Time stepping parameters
   SIM::ConvStatus solveIteration(TimeStep& param);
@@ -79,12 +88,32 @@ public:
   //! \brief Returns whether this solution driver is linear or not.
   virtual bool isLinear() const { return iteNorm == NONE; }
 
+  //! \brief Serialize internal state for restarting purposes.
+  //! \param data Container for serialized data
+  virtual bool serialize(SerializeMap& data) const;
+  //! \brief Set internal state from a serialized state.
+  //! \param[in] data Container for serialized data
+  virtual bool deSerialize(const SerializeMap& data);
+
 protected:
   //! \brief Prints out the worst DOFs when slow convergence is detected.
   //! \param os The output stream to print to
   //! \param[in] eps Only print DOF values larger than this tolerance
   void printWorst(utl::LogStream& os, double eps);
 
+  //! \brief Solves the nonlinear equations of a step by the arc-length method.
+  //! \param param Time stepping parameters
+  //! \param[in] mode Solution mode to use for this step
+  //! \param[in] zero_tolerance Truncate norm values smaller than this to zero
+  //! \param[in] outPrec Number of digits after the decimal point in norm print
+  SIM::ConvStatus solveArcLength(TimeStep& param, SIM::SolutionMode mode,
+                                 double zero_tolerance,
+                                 std::streamsize outPrec);
+  //! \brief Performs the equilibrium iterations of an arc-length increment.
+  //! \param param Time stepping parameters
+  //! \param[in] mode Solution mode to use for this step
+  SIM::ConvStatus iterateArcLength(TimeStep& param, SIM::SolutionMode mode);
+
   //! \brief Checks whether the nonlinear iterations have converged or diverged.
   virtual SIM::ConvStatus checkConvergence(TimeStep& param);
   //! \brief Updates configuration variables (solution vector) in an iteration.
@@ -126,6 +155,17 @@ protected:
 
   std::map<int,int> slowNodes; //!< Nodes for which slow convergence is detected
 
+  bool   arcLength; //!< If \e true, use arc-length path-following
+  double arcLen;    //!< Arc-length radius (computed from first step if zero)
+  double arcMin;    //!< Minimum arc-length radius
+  double arcMax;    //!< Maximum arc-length radius
+  double psi;       //!< Load term scaling factor in the arc-length constraint
+  int    nOptIt;    //!< Desired number of iterations in an arc-length step
+  double lambda;    //!< Load level of the last converged arc-length step
+  double dLambda;   //!< Load level increment of last converged step
+  Vector dUprev;    //!< Solution increment of last converged arc-length step
+  SystemVector* refLoad; //!< Reference load vector in equation ordering
+
 public:
   static const char* inputContext; //!< Input file context for solver parameters
 };
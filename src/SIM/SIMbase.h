@@ -19,6 +19,7 @@
 #include "TimeDomain.h"
 #include "Property.h"
 #include "MatVec.h"
+#include "MemoryLog.h"
 #include <set>
 
 class IntegrandBase;
@@ -30,6 +31,7 @@ class AlgEqSystem;
 class LinSolParams;
 class SystemMatrix;
 class SystemVector;
+class SparseMatrix;
 class FunctionBase;
 class RealFunc;
 class VecFunc;
@@ -110,6 +112,19 @@ public:
                   size_t nMats = 1, size_t nVec = 1, size_t nScl = 0,
                   bool withRF = false);
 
+  //! \brief Computes the multigrid transfer operators of the FE model.
+  //! \param[out] P Prolongation operators, starting at the finest level
+  //! \param[in] nLevels Maximum number of grid levels (0 = no limit)
+  //! \param[in] pCoarsen If \e true, coarsen to linear splines first
+  //!
+  //! \details The rows of the first operator refer to the equations of the
+  //! model, and the rows of each subsequent operator to the columns of the
+  //! previous one. The patch-wise operators are glued together at the patch
+  //! interfaces. Coarse DOFs without any free fine DOFs, or not vanishing at
+  //! the fixed fine DOFs, are removed.
+  bool getMultigridTransfers(std::vector<SparseMatrix>& P,
+                             int nLevels = 0, bool pCoarsen = false) const;
+
   //! \brief Associates a system vector to a system matrix.
   //! \sa AlgEqSystem::setAssociatedVector
   //! \param[in] iMat Index of a coefficient matrix
@@ -675,6 +690,11 @@ protected:
   virtual bool initBodyLoad(size_t) { return true; }
   //! \brief Initializes for integration of Neumann terms for a given property.
   virtual bool initNeumann(size_t) { return true; }
+  //! \brief Loads time-dependent data of the property fields and solution.
+  //! \details This is invoked before the patch-wise integration loops, such
+  //! that the data need not be loaded while the integration points are
+  //! evaluated in parallel.
+  bool initTimeFunctions(double t);
 
   //! \brief Assembles problem-dependent discrete terms, if any.
   virtual bool assembleDiscreteTerms(const IntegrandBase*,
@@ -762,6 +782,7 @@ protected:
   // Parallel computing attributes
   int               nGlPatches; //!< Number of global patches
   std::vector<int>  myPatches;  //!< Global patch numbers for current processor
+  bool              patchRange; //!< If \e true, \a myPatches is a sorted range
   std::map<int,int> myGlb2Loc;  //!< Global-to-local node number mapping
   const std::map<int,int>* g2l; //!< Pointer to global-to-local node mapping
 
@@ -780,6 +801,8 @@ private:
 
   mutable double extEnergy;  //!< Path integral of external forces
   mutable Vector prevForces; //!< Reaction forces of previous time step
+
+  utl::MemTracker memTopology{"Patch topology"}; //!< Memory accounting
 };
 
 #endif
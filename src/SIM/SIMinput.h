@@ -21,6 +21,7 @@
 class ModelGenerator;
 
 namespace LR { struct RefineData; }
+namespace utl { class LogStream; }
 
 
 /*!
@@ -176,6 +177,14 @@ public:
   //! \param[in] isp The input stream to read from
   //! \param[in] whiteSpace For message formatting
   bool readPatches(std::istream& isp, const char* whiteSpace = "");
+  //! \brief Reads patches from the given file.
+  //! \param[in] fileName Name of the patch file to read from
+  //! \param[in] whiteSpace For message formatting
+  //!
+  //! \details The file is memory-mapped and pre-scanned for the start of each
+  //! patch, such that the patches can be parsed concurrently. Patches that are
+  //! not on the current processor are not parsed at all.
+  bool readPatchFile(const std::string& fileName, const char* whiteSpace = "");
 
   //! \brief Connects two patches.
   //! \param[in] master Master patch
@@ -197,6 +206,12 @@ protected:
   //! \param[in] patch The value of the \a tag, either a file name or g2 string
   static std::istream* getPatchStream (const char* tag, const char* patch);
 
+  //! \brief Returns the output stream for messages while reading a patch.
+  //! \details During the concurrent patch parsing in readPatchFile,
+  //! the messages of each patch are buffered, and printed in patch order
+  //! after all patches have been read. Otherwise, this is IFEM::cout.
+  static utl::LogStream& patchLog();
+
   //! \brief Reads a patch from given input stream.
   //! \param[in] isp The input stream to read from
   //! \param[in] pchInd 0-based index of the patch to read
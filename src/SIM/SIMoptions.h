@@ -63,6 +63,15 @@ public:
   //! \brief Returns whether HDF5 output is requested or not.
   bool dumpHDF5(const char* defaultName);
 
+  //! \brief Returns whether eigensolver \a mode reports frequencies.
+  //! \details This is the case for the generalized eigenproblems, i.e., the
+  //! ARPACK modes 3, 4 and 6, and the LOBPCG modes 7 and 8. The frequencies
+  //! [Hz] are then computed from the square root of the eigenvalues.
+  static bool eigFrequency(int mode) { return mode == 3 || mode == 4 ||
+                                              (mode >= 6 && mode <= 8); }
+  //! \brief Returns whether the current eigensolver reports frequencies.
+  bool eigFrequency() const { return eigFrequency(eig); }
+
   //! \brief Prints out the simulation options to the given stream.
   utl::LogStream& print(utl::LogStream& os, bool addBlankLine = false) const;
 
@@ -70,15 +79,19 @@ public:
   bool parseProjectionMethod(const char* ptype, int version = 1);
 
 public:
-  int nGauss[2]; //!< Gaussian quadrature rules
+  int  nGauss[2];   //!< Gaussian quadrature rules
+  bool splineQuad;  //!< If \e true, use patch-wide spline quadrature rules
 
   ASM::Discretization discretization; //!< Spatial discretization option
   LinAlg::MatrixType  solver;         //!< The linear equation solver to use
 
   int num_threads_SLU; //!< Number of threads for SuperLU_MT
+  bool mixedPrecision; //!< If \e true, factorize in single precision
+  bool halfStorage; //!< If \e true, store symmetric matrices by upper triangle
+  int  maxMasters; //!< Maximum number of masters in eliminated constraints
 
   // Eigenvalue solver options
-  int    eig;   //!< Eigensolver method (1,...,5)
+  int    eig;   //!< Eigensolver method (1,...,6: ARPACK, 7,8: LOBPCG)
   int    nev;   //!< Number of eigenvalues/vectors
   int    ncv;   //!< Number of Arnoldi vectors
   double shift; //!< Eigenvalue shift
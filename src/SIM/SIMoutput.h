@@ -15,6 +15,7 @@
 #define _SIM_OUTPUT_H
 
 #include "SIMinput.h"
+#include "SampledBasis.h"
 #include "Vec3.h"
 
 class VTF;
@@ -175,6 +176,16 @@ public:
   //!
   //! \details The eigenvalue is used as a label on the step state info.
   bool writeGlvM(const Mode& mode, bool freq, int& nBlock);
+  //! \brief Writes a mode shape to the VTF-file.
+  //! \param[in] mode The mode shape eigenvector and associated eigenvalue
+  //! \param nBlock Running result block counter
+  //!
+  //! \details The eigenvalue is labelled as a frequency if the eigensolver
+  //! method of the simulation options solves a generalized eigenproblem.
+  bool writeGlvM(const Mode& mode, int& nBlock)
+  {
+    return this->writeGlvM(mode,opt.eigFrequency(),nBlock);
+  }
 
   //! \brief Writes element field for a given load/time step to the VTF-file.
   //! \param[in] field The element field to output
@@ -363,6 +374,13 @@ protected:
   std::vector<ResPtPair> myPoints; //!< User-defined result sampling points
 
 private:
+  //! \brief Sampled basis key, the point group and patch indices.
+  typedef std::pair<size_t,size_t> ResPtKey;
+  //! \brief Cached basis function values at the result points.
+  //! \details The cached values are verified against the current spline
+  //! basis and geometry of the patch before use, and recomputed if needed.
+  mutable std::map<ResPtKey,SampledBasis> myPtBasis;
+
   std::map<std::string,RealFunc*> myAddScalars; //!< Scalar functions to output
 
   int    myPrec;   //!< Output precision for result sampling
@@ -15,6 +15,7 @@
 #define _SIM_SOLUTION_H_
 
 #include "MatVec.h"
+#include "MemoryLog.h"
 #include <string>
 #include <map>
 
@@ -28,6 +29,10 @@ class SIMsolution
 public:
   //! \brief Default constructor.
   SIMsolution() {}
+  //! \brief Copy constructor.
+  //! \details The memory tracker is not copied, such that the copy gets its
+  //! own tracker accounting for its own solution vectors.
+  SIMsolution(const SIMsolution& s) : solution(s.solution) {}
   //! \brief Empty destructor.
   virtual ~SIMsolution() {}
 
@@ -39,6 +44,7 @@ public:
 protected:
   //! \brief Pushes the solution vector stack.
   //! \param[in] nsol Number of vectors to push (0 = all)
+  //! \details On output, the first vector still holds the current solution.
   void pushSolution(size_t nsol = 0);
 
   typedef std::map<std::string,std::string> SerializeMap; //!< Convenience type
@@ -64,6 +70,11 @@ protected:
   //! \param[in] n Length of array
   static void deSerialize(const std::string& data, double* v, size_t n);
 
+  //! \brief Registers the size of the solution vector stack in the memory log.
+  //! \details The size is also sampled whenever the memory log is queried,
+  //! which accounts for the resizing done directly on the solution vectors.
+  void trackMemory() { memSol.update(); }
+
 public:
   //! \brief Returns a const reference to the solution vectors.
   virtual const Vectors& getSolutions() const { return solution; }
@@ -77,6 +88,13 @@ public:
 
 protected:
   Vectors solution; //!< Stack of solution vectors
+
+private:
+  //! \brief Returns the total size (in bytes) of the solution vectors.
+  size_t solutionSize() const;
+
+  //! \brief Memory accounting of the solution vector stack
+  utl::MemTracker memSol{"Solution vectors",[this](){return solutionSize();}};
 };
 
 #endif
@@ -122,6 +122,8 @@ public:
 
   //! \brief Sets the patch to use.
   void initPatch(size_t pIdx);
+  //! \brief Prepares the solution fields for evaluation at the given time.
+  bool initTime(double t);
 
 private:
   //! \brief Parses expression functions from XML definition.
@@ -15,6 +15,11 @@
 #define _FIELD_FUNCTIONS_H
 
 #include "TensorFunction.h"
+#include <atomic>
+#include <future>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 
 class Field;
@@ -51,6 +56,20 @@ protected:
 
 /*!
   \brief Base class for spatial functions, defined from a HDF5-file.
+
+  \details The time of each level in the file is read once, on the first
+  evaluation at a given time. The field values at a given time are then
+  interpolated linearly between the two levels bracketing that time,
+  provided they are defined on the same basis, otherwise the closest level
+  is used. The basis definitions are only parsed when they change.
+
+  The field values should be loaded through the \a initTime method of the
+  sub-classes before the integration point loops. If the time of a point
+  differs from the loaded time, the values are reloaded during the point
+  evaluation. The reloading waits until no other thread is evaluating the
+  field, so it is safe but slow if the threads use different times.
+  When the HDF5 library is thread-safe, the next time level is read in a
+  background thread while the current one is used.
 */
 
 class FieldFuncHDF5 : public FieldFuncBase
@@ -73,8 +92,37 @@ protected:
             const std::string& basisName, int level,
             bool isScalar = false);
 
+  //! \brief Loads field values interpolated to the specified time.
+  //! \param[in] fieldNames Name of the field components in the HDF5-file
+  //! \param[in] basisName Name of the basis which the field values refer to
+  //! \param[in] time The time to interpolate the field values to
+  //! \param[in] isScalar If \e true, assume this is a scalar field
+  //!
+  //! \details Nothing is done if the field values already are loaded for
+  //! the given time, or if the HDF5-file contains no time information.
+  bool setTime(const std::vector<std::string>& fieldNames,
+               const std::string& basisName, double time,
+               bool isScalar = false);
+
+  //! \brief Loads and locks the field values for the time of point \a X.
+  //! \param[in] fieldNames Name of the field components in the HDF5-file
+  //! \param[in] basisName Name of the basis which the field values refer to
+  //! \param[in] X Evaluation point, the time is used if it is a Vec4
+  //! \param[in] isScalar If \e true, assume this is a scalar field
+  //! \return Shared lock on the field values, not owned if the loading failed
+  std::shared_lock<std::shared_timed_mutex>
+  lockTime(const std::vector<std::string>& fieldNames,
+           const std::string& basisName, const Vec3& X,
+           bool isScalar = false);
+
   //! \brief Finds the level whose time is closest to the specified time.
   int findClosestLevel(double time) const;
+  //! \brief Finds the two levels bracketing the specified time.
+  //! \param[in] time The time to find levels for
+  //! \param[out] level0 The level before (or at) \a time
+  //! \param[out] level1 The level after \a time
+  //! \return Interpolation weight of \a level1, negative if no time index
+  double findLevels(double time, int& level0, int& level1) const;
 
   //! \brief Adds a patch-wise field with the given coefficient values.
   //! \param[in] pch The patch to define the field over
@@ -83,12 +131,59 @@ protected:
   //! \brief Clears the field container.
   virtual void clearField() = 0;
 
+  //! \brief Guards the field values against reloading while evaluated.
+  mutable std::shared_timed_mutex fieldLock;
+
 private:
+  //! \brief Field values and basis definitions of one time level.
+  struct LevelData
+  {
+    int level = -1; //!< The time level of this data
+    std::vector<std::string>       basis; //!< Basis of each patch, if updated
+    std::vector<std::vector<Real>> coefs; //!< Interleaved patch field values
+  };
+
+  //! \brief Reads the time of each level from the HDF5-file.
+  void readTimeIndex() const;
+  //! \brief Reads the field values and basis definitions of a time level.
+  LevelData readLevel(const std::vector<std::string>& fieldNames,
+                      const std::string& basisName, int level) const;
+  //! \brief Returns the data of a time level, reading it if not cached.
+  const LevelData& getLevel(const std::vector<std::string>& fieldNames,
+                            const std::string& basisName, int level);
+  //! \brief Starts reading a time level in a background thread.
+  void prefetch(const std::vector<std::string>& fieldNames,
+                const std::string& basisName, int level);
+  //! \brief Loads field values interpolated between two time levels.
+  //! \param[in] fieldNames Name of the field components in the HDF5-file
+  //! \param[in] basisName Name of the basis which the field values refer to
+  //! \param[in] level0 First time level
+  //! \param[in] level1 Second time level
+  //! \param[in] w Interpolation weight of the second time level
+  //! \param[in] isScalar If \e true, assume this is a scalar field
+  bool load(const std::vector<std::string>& fieldNames,
+            const std::string& basisName, int level0, int level1,
+            double w, bool isScalar);
+
   HDF5Reader* hdf5; //!< The HDF5-file containing the field data
   ProcessAdm* pAdm; //!< Process administrator for the HDF5-file reader
 
-  mutable int    lastLevel; //!< The last time level read from
-  mutable double lastTime;  //!< The time of \a lastLevel
+  mutable std::mutex hdf5Lock; //!< Serializes the access to the HDF5-file
+
+  mutable std::vector<Real> times; //!< Time of each level in the HDF5-file
+  mutable bool haveTimes;          //!< If \e true, \a times has been read
+
+  std::vector<std::string> basis; //!< Basis definitions of current patches
+  std::map<int,LevelData>  cache; //!< Data of the recently used time levels
+  std::future<LevelData>   next;  //!< Time level read in the background
+  int                      nextLevel; //!< Time level of \a next
+  bool                     asyncRead; //!< If \e true, prefetch in background
+
+  int    lev0;   //!< First time level of the current field values
+  int    lev1;   //!< Second time level of the current field values
+  double weight; //!< Interpolation weight of the second time level
+
+  std::atomic<double> curTime; //!< Time of the current field values
 };
 
 
@@ -113,6 +208,11 @@ public:
 
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
+  //! \brief Loads the field values for the given time.
+  virtual bool initTime(double t)
+  {
+    return this->setTime({fName},bName,t,true);
+  }
 
 protected:
   //! \brief Evaluates the scalar field function.
@@ -126,8 +226,6 @@ protected:
   virtual void clearField();
 
 private:
-  mutable int currentLevel; //!< Current time level to evaluate at
-
   std::string fName; //!< Name of field
   std::string bName; //!< Name of basis
 
@@ -189,10 +287,11 @@ protected:
   virtual void clearField();
 
   //! \brief Evaluates the field at the givent point \b X.
+  //! \return Field values, empty if no field on current patch
   std::vector<Real> getValues(const Vec3& X);
 
-private:
-  mutable int currentLevel; //!< Current time level to evaluate at
+  //! \brief Loads the field values for the given time.
+  bool loadTime(double t) { return this->setTime(fName,bName,t); }
 
 protected:
   std::vector<std::string> fName; //!< Name of field components
@@ -223,6 +322,8 @@ public:
 
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
+  //! \brief Loads the field values for the given time.
+  virtual bool initTime(double t) { return this->loadTime(t); }
 
 protected:
   //! \brief Evaluates the vectorial field function.
@@ -251,6 +352,8 @@ public:
 
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
+  //! \brief Loads the field values for the given time.
+  virtual bool initTime(double t) { return this->loadTime(t); }
 
 protected:
   //! \brief Evaluates the tensorial field function.
@@ -279,6 +382,8 @@ public:
 
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
+  //! \brief Loads the field values for the given time.
+  virtual bool initTime(double t) { return this->loadTime(t); }
 
 protected:
   //! \brief Evaluates the tensorial field function.
@@ -0,0 +1,701 @@
+// $Id$
+//==============================================================================
+//!
+//! \file FixedTensor.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Second- and fourth-order tensors of fixed spatial dimension.
+//!
+//==============================================================================
+
+#ifndef _FIXED_TENSOR_H
+#define _FIXED_TENSOR_H
+
+#include "Tensor.h"
+#include "Tensor4.h"
+#include "Vec3.h"
+#include <array>
+#include <cmath>
+
+
+/*!
+  \brief Non-symmetric second-order tensor of fixed dimension \a N.
+
+  \details The components are stored column-wise in a fixed-size array,
+  in the same order as in the Tensor class. Since the dimension is a
+  template parameter, all loops have compile-time bounds and no heap
+  allocation is involved. This class is therefore intended for temporary
+  tensors in integration point kernels. The conversion operator to Tensor
+  allows such objects to be passed to the existing interfaces.
+*/
+
+template<unsigned short N> class FixedTensor
+{
+  static_assert(N >= 1 && N <= 3, "FixedTensor: Invalid dimension");
+
+  std::array<Real,N*N> v; //!< The tensor components
+
+  //! \brief Returns a 0-based array index for the given tensor indices.
+  static constexpr size_t index(size_t i, size_t j) { return i-1 + N*(j-1); }
+
+public:
+  //! \brief Constructor creating a zero or identity tensor.
+  explicit FixedTensor(bool identity = false) { this->diag(identity ? 1 : 0); }
+  //! \brief Constructor copying (the leading part of) a Tensor.
+  explicit FixedTensor(const Tensor& T)
+  {
+    v.fill(Real(0));
+    for (size_t j = 1; j <= N && j <= T.dim(); j++)
+      for (size_t i = 1; i <= N && i <= T.dim(); i++)
+        v[index(i,j)] = T(i,j);
+  }
+
+  //! \brief Conversion to a Tensor.
+  operator Tensor() const
+  {
+    return Tensor(std::vector<Real>(v.begin(),v.end()));
+  }
+
+  //! \brief Sets \a *this to the 0-tensor.
+  void zero() { v.fill(Real(0)); }
+  //! \brief Sets \a *this to a diagonal tensor with \a value on the diagonal.
+  void diag(Real value = Real(1))
+  {
+    v.fill(Real(0));
+    for (size_t i = 1; i <= N; i++)
+      v[index(i,i)] = value;
+  }
+
+  //! \brief Reference through a pointer.
+  const Real* ptr() const { return v.data(); }
+  //! \brief Returns the dimension of this tensor.
+  static constexpr unsigned short dim() { return N; }
+
+  //! \brief Index-1 based component reference.
+  const Real& operator()(size_t i, size_t j) const { return v[index(i,j)]; }
+  //! \brief Index-1 based component access.
+  Real& operator()(size_t i, size_t j) { return v[index(i,j)]; }
+
+  //! \brief Incrementation operator.
+  FixedTensor& operator+=(const FixedTensor& T)
+  {
+    for (size_t i = 0; i < N*N; i++) v[i] += T.v[i];
+    return *this;
+  }
+  //! \brief Decrementation operator.
+  FixedTensor& operator-=(const FixedTensor& T)
+  {
+    for (size_t i = 0; i < N*N; i++) v[i] -= T.v[i];
+    return *this;
+  }
+  //! \brief Scaling operator.
+  FixedTensor& operator*=(Real val)
+  {
+    for (Real& c : v) c *= val;
+    return *this;
+  }
+
+  //! \brief Dyadic (outer) product between two vectors.
+  FixedTensor& outerProd(const Vec3& a, const Vec3& b)
+  {
+    for (size_t j = 1; j <= N; j++)
+      for (size_t i = 1; i <= N; i++)
+        v[index(i,j)] = a[i-1]*b[j-1];
+    return *this;
+  }
+
+  //! \brief Returns the inner-product of \a *this and the given tensor.
+  Real innerProd(const FixedTensor& T) const
+  {
+    Real s = Real(0);
+    for (size_t i = 0; i < N*N; i++) s += v[i]*T.v[i];
+    return s;
+  }
+
+  //! \brief Returns the transpose of the tensor.
+  FixedTensor transposed() const
+  {
+    FixedTensor T;
+    for (size_t j = 1; j <= N; j++)
+      for (size_t i = 1; i <= N; i++)
+        T.v[index(j,i)] = v[index(i,j)];
+    return T;
+  }
+
+  //! \brief Returns the trace of the tensor.
+  Real trace() const
+  {
+    Real t = Real(0);
+    for (size_t i = 1; i <= N; i++) t += v[index(i,i)];
+    return t;
+  }
+
+  //! \brief Returns the determinant of the tensor.
+  Real det() const
+  {
+    const FixedTensor& T = *this;
+    switch (N) {
+    case 1:
+      return v[0];
+    case 2:
+      return v[0]*v[3] - v[1]*v[2];
+    default:
+      return T(1,1)*(T(2,2)*T(3,3) - T(2,3)*T(3,2))
+        -    T(1,2)*(T(2,1)*T(3,3) - T(2,3)*T(3,1))
+        +    T(1,3)*(T(2,1)*T(3,2) - T(2,2)*T(3,1));
+    }
+  }
+
+  //! \brief Inverts the tensor.
+  //! \param[in] tol Division by zero tolerance
+  //! \return Determinant of the tensor, or zero if singular
+  Real inverse(Real tol = Real(0))
+  {
+    Real d = this->det();
+    if (d <= tol && d >= -tol)
+      return Real(0);
+
+    const FixedTensor T(*this);
+    switch (N) {
+    case 1:
+      v[0] = Real(1) / d;
+      break;
+    case 2:
+      v[0] =  T.v[3] / d;
+      v[1] = -T.v[1] / d;
+      v[2] = -T.v[2] / d;
+      v[3] =  T.v[0] / d;
+      break;
+    default:
+      for (size_t i = 1; i <= 3; i++)
+        for (size_t j = 1; j <= 3; j++)
+        {
+          // Cofactor of T(j,i), using cyclic index permutation
+          size_t j1 = j%3+1, j2 = (j+1)%3+1, i1 = i%3+1, i2 = (i+1)%3+1;
+          v[index(i,j)] = (T(j1,i1)*T(j2,i2) - T(j1,i2)*T(j2,i1)) / d;
+        }
+    }
+
+    return d;
+  }
+
+  //! \brief Multiplication between two tensors.
+  friend FixedTensor operator*(const FixedTensor& A, const FixedTensor& B)
+  {
+    FixedTensor C;
+    for (size_t j = 1; j <= N; j++)
+      for (size_t k = 1; k <= N; k++)
+        for (size_t i = 1; i <= N; i++)
+          C(i,j) += A(i,k)*B(k,j);
+    return C;
+  }
+
+  //! \brief Multiplication between a tensor and a point vector.
+  friend Vec3 operator*(const FixedTensor& T, const Vec3& x)
+  {
+    Vec3 y;
+    for (size_t i = 1; i <= N; i++)
+      for (size_t j = 1; j <= N; j++)
+        y[i-1] += T(i,j)*x[j-1];
+    return y;
+  }
+
+  //! \brief Multiplication between a scalar and a tensor.
+  friend FixedTensor operator*(Real a, const FixedTensor& T)
+  {
+    FixedTensor S(T);
+    return S *= a;
+  }
+
+  //! \brief Adding two tensors.
+  friend FixedTensor operator+(const FixedTensor& A, const FixedTensor& B)
+  {
+    FixedTensor C(A);
+    return C += B;
+  }
+
+  //! \brief Subtracting two tensors.
+  friend FixedTensor operator-(const FixedTensor& A, const FixedTensor& B)
+  {
+    FixedTensor C(A);
+    return C -= B;
+  }
+};
+
+
+/*!
+  \brief Symmetric second-order tensor of fixed dimension \a N.
+
+  \details The components are stored in the same order as in the SymmTensor
+  class, i.e., s11, s22, s33, s12, s23, s13 in 3D and s11, s22, s12 in 2D.
+  If \a W33 is \e true and \a N = 2, the 33-component is included as the
+  third component, i.e., s11, s22, s33, s12, which is used to represent
+  stresses in plane strain and axisymmetric models.
+*/
+
+template<unsigned short N, bool W33 = false> class FixedSymmTensor
+{
+  static_assert(N >= 1 && N <= 3, "FixedSymmTensor: Invalid dimension");
+
+public:
+  //! \brief Number of stored components.
+  static constexpr size_t S = N == 3 ? 6 : (N == 2 ? (W33 ? 4 : 3) : 1);
+
+  //! \brief Returns a 0-based array index for the given tensor indices.
+  static constexpr size_t index(size_t i, size_t j)
+  {
+    return i == j ? i-1 : (N == 2 ? S-1 : (i == j+1 || i+2 == j ? j+2 : i+2));
+  }
+
+  //! \brief Constructor creating a zero or (scaled) identity tensor.
+  explicit FixedSymmTensor(Real value = Real(0)) { *this = value; }
+  //! \brief Constructor copying a SymmTensor of the same dimension.
+  explicit FixedSymmTensor(const SymmTensor& T)
+  {
+    const std::vector<Real>& t = T;
+    v.fill(Real(0));
+    if (t.size() == S)
+      std::copy(t.begin(),t.end(),v.begin());
+    else if (t.size() == 4 && S == 3)
+    {
+      v[0] = t[0]; v[1] = t[1]; v[S-1] = t[3];
+    }
+    else if (t.size() == 3 && S == 4)
+    {
+      v[0] = t[0]; v[1] = t[1]; v[S-1] = t[2];
+    }
+  }
+
+  //! \brief Conversion to a SymmTensor.
+  operator SymmTensor() const
+  {
+    return SymmTensor(std::vector<Real>(v.begin(),v.end()));
+  }
+
+  //! \brief Sets \a *this to a scaled identity tensor.
+  FixedSymmTensor& operator=(Real value)
+  {
+    for (size_t i = 0; i < S; i++)
+      v[i] = i < N || (W33 && i == 2) ? value : Real(0);
+    return *this;
+  }
+
+  //! \brief Sets \a *this to the 0-tensor.
+  void zero() { v.fill(Real(0)); }
+
+  //! \brief Reference through a pointer.
+  const Real* ptr() const { return v.data(); }
+  //! \brief Returns the dimension of this tensor.
+  static constexpr unsigned short dim() { return N; }
+  //! \brief Returns the number of stored components.
+  static constexpr size_t size() { return S; }
+
+  //! \brief Index-1 based component reference.
+  const Real& operator()(size_t i, size_t j) const { return v[index(i,j)]; }
+  //! \brief Index-1 based component access.
+  Real& operator()(size_t i, size_t j) { return v[index(i,j)]; }
+  //! \brief Index-0 based reference to a stored component.
+  const Real& operator[](size_t i) const { return v[i]; }
+  //! \brief Index-0 based access to a stored component.
+  Real& operator[](size_t i) { return v[i]; }
+
+  //! \brief Incrementation operator.
+  FixedSymmTensor& operator+=(const FixedSymmTensor& T)
+  {
+    for (size_t i = 0; i < S; i++) v[i] += T.v[i];
+    return *this;
+  }
+  //! \brief Adds a scaled unit tensor to \a *this.
+  FixedSymmTensor& operator+=(Real a)
+  {
+    for (size_t i = 0; i < N; i++) v[i] += a;
+    if (W33) v[2] += a;
+    return *this;
+  }
+  //! \brief Decrementation operator.
+  FixedSymmTensor& operator-=(const FixedSymmTensor& T)
+  {
+    for (size_t i = 0; i < S; i++) v[i] -= T.v[i];
+    return *this;
+  }
+  //! \brief Scaling operator.
+  FixedSymmTensor& operator*=(Real val)
+  {
+    for (Real& c : v) c *= val;
+    return *this;
+  }
+
+  //! \brief Returns the trace of the tensor.
+  Real trace() const
+  {
+    Real t = W33 ? v[2] : Real(0);
+    for (size_t i = 0; i < N; i++) t += v[i];
+    return t;
+  }
+
+  //! \brief Returns the determinant of the tensor.
+  Real det() const
+  {
+    switch (N) {
+    case 1:
+      return v[0];
+    case 2:
+      return (v[0]*v[1] - v[S-1]*v[S-1]) * (W33 ? v[2] : Real(1));
+    default:
+      return v[0]*(v[1]*v[2] - v[4]*v[4])
+        -    v[3]*(v[3]*v[2] - v[5]*v[4])
+        +    v[5]*(v[3]*v[4] - v[5]*v[1]);
+    }
+  }
+
+  //! \brief Inverts the tensor.
+  //! \param[in] tol Division by zero tolerance
+  //! \return Determinant of the tensor, or zero if singular
+  Real inverse(Real tol = Real(0))
+  {
+    Real d = this->det();
+    if (d <= tol && d >= -tol)
+      return Real(0);
+
+    const std::array<Real,S> T(v);
+    switch (N) {
+    case 1:
+      v[0] = Real(1) / d;
+      break;
+    case 2:
+      if (W33)
+      {
+        Real d2 = d / T[2];
+        v[0] = T[1] / d2;
+        v[1] = T[0] / d2;
+        v[2] = Real(1) / T[2];
+        v[3] = -T[3] / d2;
+      }
+      else
+      {
+        v[0] =  T[1] / d;
+        v[1] =  T[0] / d;
+        v[2] = -T[2] / d;
+      }
+      break;
+    default:
+      v[0] =  (T[1]*T[2] - T[4]*T[4]) / d;
+      v[1] =  (T[0]*T[2] - T[5]*T[5]) / d;
+      v[2] =  (T[0]*T[1] - T[3]*T[3]) / d;
+      v[3] = -(T[3]*T[2] - T[5]*T[4]) / d;
+      v[4] = -(T[0]*T[4] - T[5]*T[3]) / d;
+      v[5] =  (T[3]*T[4] - T[5]*T[1]) / d;
+    }
+
+    return d;
+  }
+
+  //! \brief Returns the second principal invariant of the tensor.
+  Real I2() const
+  {
+    Real s = Real(0);
+    for (size_t i = 0; i < S; i++)
+      s += (i < N || (W33 && i == 2) ? Real(1) : Real(2))*v[i]*v[i];
+    Real t = this->trace();
+    return Real(0.5)*(t*t - s);
+  }
+
+  //! \brief Returns the second invariant of the deviatoric tensor.
+  Real J2() const { Real t = this->trace(); return t*t/Real(3) - this->I2(); }
+
+  //! \brief Returns the inner-product (L2-norm) of the tensor.
+  Real L2norm(bool doSqrt = true) const
+  {
+    Real s = Real(0);
+    for (size_t i = 0; i < S; i++)
+      s += (i < N || (W33 && i == 2) ? Real(1) : Real(2))*v[i]*v[i];
+    return doSqrt ? std::sqrt(s) : s;
+  }
+
+  //! \brief Returns the von Mises value of the tensor.
+  Real vonMises(bool doSqrt = true) const
+  {
+    if (N == 1)
+      return doSqrt ? v[0] : v[0]*v[0];
+
+    Real vms = Real(3)*this->J2();
+    return doSqrt ? std::sqrt(vms) : vms;
+  }
+
+  //! \brief Returns the deviatoric part of the tensor.
+  FixedSymmTensor deviator() const
+  {
+    FixedSymmTensor D(*this);
+    return D += -this->trace()/Real(W33 ? 3 : N);
+  }
+
+  //! \brief Dyadic (outer) product between two identical vectors.
+  FixedSymmTensor& outerProd(const Vec3& u)
+  {
+    for (size_t i = 1; i <= N; i++)
+      for (size_t j = 1; j <= i; j++)
+        v[index(i,j)] = u[i-1]*u[j-1];
+    if (W33) v[2] = Real(0);
+    return *this;
+  }
+
+  //! \brief Congruence transformation, \f${\bf T} {\bf S} {\bf T}^T\f$.
+  //! \details The 33-component of a 2D tensor is not affected.
+  FixedSymmTensor& transform(const FixedTensor<N>& T)
+  {
+    FixedTensor<N> TS;
+    for (size_t i = 1; i <= N; i++)
+      for (size_t j = 1; j <= N; j++)
+        for (size_t k = 1; k <= N; k++)
+          TS(i,j) += T(i,k)*(*this)(k,j);
+
+    for (size_t i = 1; i <= N; i++)
+      for (size_t j = 1; j <= i; j++)
+      {
+        Real s = Real(0);
+        for (size_t k = 1; k <= N; k++)
+          s += TS(i,k)*T(j,k);
+        v[index(i,j)] = s;
+      }
+
+    return *this;
+  }
+
+  //! \brief Push-forward with the deformation gradient \b F.
+  //! \details Computes \f$J^{-1} {\bf F} {\bf S} {\bf F}^T\f$, e.g., the
+  //! Cauchy stress from the second Piola-Kirchhoff stress. In 2D, the
+  //! out-of-plane stretch is assumed to be one.
+  FixedSymmTensor& pushForward(const FixedTensor<N>& F)
+  {
+    Real J = F.det();
+    this->transform(F);
+    return J != Real(0) ? *this *= Real(1)/J : *this;
+  }
+
+  //! \brief Constructs the right Cauchy-Green tensor from a deformation tensor.
+  FixedSymmTensor& rightCauchyGreen(const FixedTensor<N>& F)
+  {
+    for (size_t i = 1; i <= N; i++)
+      for (size_t j = 1; j <= i; j++)
+      {
+        Real c = Real(0);
+        for (size_t k = 1; k <= N; k++)
+          c += F(k,i)*F(k,j);
+        v[index(i,j)] = c;
+      }
+    if (W33) v[2] = Real(1);
+    return *this;
+  }
+
+  //! \brief Multiplication between a scalar and a symmetric tensor.
+  friend FixedSymmTensor operator*(Real a, const FixedSymmTensor& T)
+  {
+    FixedSymmTensor A(T);
+    return A *= a;
+  }
+
+  //! \brief Adding two symmetric tensors.
+  friend FixedSymmTensor operator+(const FixedSymmTensor& A,
+                                   const FixedSymmTensor& B)
+  {
+    FixedSymmTensor C(A);
+    return C += B;
+  }
+
+  //! \brief Subtracting two symmetric tensors.
+  friend FixedSymmTensor operator-(const FixedSymmTensor& A,
+                                   const FixedSymmTensor& B)
+  {
+    FixedSymmTensor C(A);
+    return C -= B;
+  }
+
+  //! \brief Returns the double contraction \b A : \b B.
+  friend Real operator*(const FixedSymmTensor& A, const FixedSymmTensor& B)
+  {
+    Real s = Real(0);
+    for (size_t i = 0; i < S; i++)
+      s += (i < N || (W33 && i == 2) ? Real(1) : Real(2))*A.v[i]*B.v[i];
+    return s;
+  }
+
+private:
+  std::array<Real,S> v; //!< The tensor components
+};
+
+
+/*!
+  \brief Symmetric fourth-order tensor of fixed dimension \a N.
+
+  \details The tensor is stored through its matrix representation, with rows
+  and columns ordered as the components of FixedSymmTensor<N,W33>.
+  The tensor is assumed to have both minor symmetries. It can be converted
+  to and from the SymmTensor4 class when \a W33 is \e false.
+*/
+
+template<unsigned short N, bool W33 = false> class FixedSymmTensor4
+{
+  //! \brief The symmetric second-order tensor type this tensor acts on.
+  typedef FixedSymmTensor<N,W33> SymmT;
+  //! \brief Dimension of the matrix representation.
+  static constexpr size_t M = SymmT::S;
+
+  //! \brief Returns the index in the matrix representation of a component.
+  static constexpr size_t index(size_t i, size_t j, size_t k, size_t l)
+  {
+    return SymmT::index(i,j)*M + SymmT::index(k,l);
+  }
+
+  //! \brief Returns \e true if stored component \a i is an off-diagonal term.
+  static constexpr bool shear(size_t i) { return i >= N && !(W33 && i == 2); }
+
+public:
+  //! \brief Constructor creating a zero or a (scaled) symmetric identity.
+  //! \details The symmetric identity maps any symmetric tensor onto itself.
+  explicit FixedSymmTensor4(Real scale = Real(0))
+  {
+    v.fill(Real(0));
+    for (size_t i = 0; i < M; i++)
+      v[i*M+i] = shear(i) ? Real(0.5)*scale : scale;
+  }
+  //! \brief Constructor copying a SymmTensor4 of the same dimension.
+  explicit FixedSymmTensor4(const SymmTensor4& T)
+  {
+    static_assert(!W33, "FixedSymmTensor4: No SymmTensor4 counterpart");
+    // The components are copied one by one, since the matrix
+    // representation of SymmTensor4 has a different row stride
+    for (unsigned short i = 1; i <= N; i++)
+      for (unsigned short j = 1; j <= i; j++)
+        for (unsigned short k = 1; k <= N; k++)
+          for (unsigned short l = 1; l <= k; l++)
+            v[index(i,j,k,l)] = T(i,j,k,l);
+  }
+
+  //! \brief Conversion to a SymmTensor4.
+  operator SymmTensor4() const
+  {
+    static_assert(!W33, "FixedSymmTensor4: No SymmTensor4 counterpart");
+    SymmTensor4 T(N);
+    for (unsigned short i = 1; i <= N; i++)
+      for (unsigned short j = 1; j <= i; j++)
+        for (unsigned short k = 1; k <= N; k++)
+          for (unsigned short l = 1; l <= k; l++)
+            T(i,j,k,l) = v[index(i,j,k,l)];
+    return T;
+  }
+
+  //! \brief Creates the isotropic elasticity tensor.
+  //! \param[in] lambda Lame's first parameter
+  //! \param[in] mu Shear modulus
+  static FixedSymmTensor4 isotropic(Real lambda, Real mu)
+  {
+    FixedSymmTensor4 C(Real(2)*mu);
+    for (size_t i = 0; i < M; i++)
+      for (size_t j = 0; j < M; j++)
+        if (!shear(i) && !shear(j))
+          C.v[i*M+j] += lambda;
+    return C;
+  }
+
+  //! \brief Sets \a *this to the 0-tensor.
+  void zero() { v.fill(Real(0)); }
+
+  //! \brief Reference through a pointer.
+  const Real* ptr() const { return v.data(); }
+
+  //! \brief Index-1 based component reference.
+  const Real& operator()(size_t i, size_t j, size_t k, size_t l) const
+  {
+    return v[index(i,j,k,l)];
+  }
+  //! \brief Index-1 based component access.
+  Real& operator()(size_t i, size_t j, size_t k, size_t l)
+  {
+    return v[index(i,j,k,l)];
+  }
+
+  //! \brief Incrementation operator.
+  FixedSymmTensor4& operator+=(const FixedSymmTensor4& T)
+  {
+    for (size_t i = 0; i < M*M; i++) v[i] += T.v[i];
+    return *this;
+  }
+  //! \brief Scaling operator.
+  FixedSymmTensor4& operator*=(Real val)
+  {
+    for (Real& c : v) c *= val;
+    return *this;
+  }
+
+  //! \brief Adds the dyadic product \a s * \b A \f$\otimes\f$ \b B.
+  FixedSymmTensor4& addOuter(const SymmT& A, const SymmT& B, Real s = Real(1))
+  {
+    for (size_t i = 0; i < M; i++)
+      for (size_t j = 0; j < M; j++)
+        v[i*M+j] += s*A[i]*B[j];
+    return *this;
+  }
+
+  //! \brief Push-forward with the deformation gradient \b F.
+  //! \details Computes \f$c_{ijkl} = J^{-1} F_{iI} F_{jJ} F_{kK} F_{lL}
+  //! C_{IJKL}\f$, e.g., the spatial tangent from the material tangent.
+  //! The out-of-plane components of a 2D tensor are not affected.
+  FixedSymmTensor4& pushForward(const FixedTensor<N>& F)
+  {
+    // Transformation matrix of the stored components, where the columns
+    // of the shear terms sum the contributions from both index orderings
+    std::array<Real,M*M> Q;
+    Q.fill(Real(0));
+    for (size_t i = 1; i <= N; i++)
+      for (size_t j = 1; j <= i; j++)
+        for (size_t k = 1; k <= N; k++)
+          for (size_t l = 1; l <= N; l++)
+            Q[SymmT::index(i,j)*M+SymmT::index(k,l)] += F(i,k)*F(j,l);
+    if (W33)
+      Q[2*M+2] = Real(1);
+
+    Real J = F.det();
+    std::array<Real,M*M> QC;
+    for (size_t i = 0; i < M; i++)
+      for (size_t j = 0; j < M; j++)
+      {
+        Real s = Real(0);
+        for (size_t k = 0; k < M; k++)
+          s += Q[i*M+k]*v[k*M+j];
+        QC[i*M+j] = s;
+      }
+
+    for (size_t i = 0; i < M; i++)
+      for (size_t j = 0; j < M; j++)
+      {
+        Real s = Real(0);
+        for (size_t k = 0; k < M; k++)
+          s += QC[i*M+k]*Q[j*M+k];
+        v[i*M+j] = J != Real(0) ? s/J : s;
+      }
+
+    return *this;
+  }
+
+  //! \brief Contraction with a symmetric tensor, \b C : \b E.
+  friend SymmT operator*(const FixedSymmTensor4& C, const SymmT& E)
+  {
+    SymmT S;
+    for (size_t i = 0; i < M; i++)
+    {
+      Real s = Real(0);
+      for (size_t j = 0; j < M; j++)
+        s += C.v[i*M+j]*E[j]*(shear(j) ? Real(2) : Real(1));
+      S[i] = s;
+    }
+    return S;
+  }
+
+private:
+  std::array<Real,M*M> v; //!< Matrix representation of the tensor
+};
+
+#endif
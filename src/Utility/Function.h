@@ -164,6 +164,10 @@ public:
 
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t) { return true; }
+  //! \brief Prepares the function for evaluation at the given time.
+  //! \details Reimplement this method for functions that need to load data
+  //! for each time, before being evaluated in parallel.
+  virtual bool initTime(double) { return true; }
 
   //! \brief Checks if a specified point is within the function domain.
   virtual bool inDomain(const Vec3&) const { return true; }
@@ -244,6 +248,11 @@ class TractionFunc : public utl::Function2<Vec3,Vec3>
 public:
   //! \brief Returns whether the traction is always normal to the face or not.
   virtual bool isNormalPressure() const { return false; }
+
+  //! \brief Prepares the function for evaluation at the given time.
+  //! \details Reimplement this method for tractions derived from functions
+  //! that need to load data for each time, see FunctionBase::initTime.
+  virtual bool initTime(double) { return true; }
 };
 
 
@@ -273,6 +282,9 @@ public:
   //! \brief Returns whether the function is identically zero or not.
   virtual bool isZero() const { return pressure ? pressure->isZero() : true; }
 
+  //! \brief Prepares the pressure function for evaluation at the given time.
+  virtual bool initTime(double t);
+
 protected:
   //! \brief Evaluates the traction at point \a x and surface normal \a n.
   virtual Vec3 evaluate(const Vec3& x, const Vec3& n) const;
@@ -299,6 +311,9 @@ public:
   //! \brief Returns whether the function is identically zero or not.
   virtual bool isZero() const;
 
+  //! \brief Prepares the tensor function for evaluation at the given time.
+  virtual bool initTime(double t);
+
 protected:
   //! \brief Evaluates the traction at point \a x and surface normal \a n.
   virtual Vec3 evaluate(const Vec3& x, const Vec3& n) const;
@@ -14,6 +14,8 @@
 #ifndef _GAUSS_QUADRATURE_H
 #define _GAUSS_QUADRATURE_H
 
+#include <vector>
+
 
 /*!
   \brief Gaussian quadrature rules in one dimension.
@@ -24,15 +26,28 @@ class GaussQuadrature
 public:
   //! \brief Get gauss point coordinates in the domain [-1,1].
   //! \param[in] n Number of gauss points
+  //! \return Pointer to \a n coordinates, or nullptr if \a n < 1
+  //!
+  //! \details The \a n -point rule integrates polynomials up to
+  //! degree 2n-1 exactly. Any \a n > 0 is supported, see getGauss().
   static const double* getCoord (int n) { return getGauss(n,0); }
   //! \brief Get gauss point weights.
   //! \param[in] n Number of gauss points
+  //! \return Pointer to \a n weights, or nullptr if \a n < 1
   static const double* getWeight(int n) { return getGauss(n,1); }
 
+  //! \brief Computes the gauss point coordinates and weights of a rule.
+  //! \param[in] n Number of gauss points
+  //! \param[out] rule Gauss point coordinates followed by the weights
+  static void computeRule(int n, std::vector<double>& rule);
+
 private:
   //! \brief Returns the gauss point coordinates or weights.
   //! \param[in] n Number of gauss points
   //! \param[in] i Option telling what to return (0=coordinates, 1=weights)
+  //!
+  //! \details The rules up to 10 points are tabulated,
+  //! whereas the higher-order rules are computed when first requested.
   static const double* getGauss(int n, int i);
 };
 
@@ -58,6 +58,46 @@ public:
   //! \param[out] data The 3D array to read data into
   bool read3DArray(const std::string& name, Matrix3D& data);
 
+  //! \brief Returns the dimensions and value type of a 3D array.
+  //! \param[in] name The name (path in HDF5 file) to the array
+  //! \param[out] dims Size of the array in each direction
+  //! \param[out] real \e true if the values are floating point numbers
+  //! \return Byte size of the values, or -1 if \a name is not a 3D array
+  int get3DArrayInfo(const std::string& name, size_t* dims, bool& real);
+
+  //! \brief Reads a block of a 3D array of 8-bit values.
+  //! \param[in] name The name (path in HDF5 file) to the array
+  //! \param[in] start Offset of the block in each direction
+  //! \param[in] count Size of the block in each direction
+  //! \param[out] data Values of the block, with the last index running fastest
+  bool read3DBlock(const std::string& name,
+                   const size_t* start, const size_t* count,
+                   std::vector<unsigned char>& data);
+  //! \brief Reads a block of a 3D array of 16-bit values.
+  //! \param[in] name The name (path in HDF5 file) to the array
+  //! \param[in] start Offset of the block in each direction
+  //! \param[in] count Size of the block in each direction
+  //! \param[out] data Values of the block, with the last index running fastest
+  bool read3DBlock(const std::string& name,
+                   const size_t* start, const size_t* count,
+                   std::vector<unsigned short>& data);
+  //! \brief Reads a block of a 3D array in single precision.
+  //! \param[in] name The name (path in HDF5 file) to the array
+  //! \param[in] start Offset of the block in each direction
+  //! \param[in] count Size of the block in each direction
+  //! \param[out] data Values of the block, with the last index running fastest
+  bool read3DBlock(const std::string& name,
+                   const size_t* start, const size_t* count,
+                   std::vector<float>& data);
+  //! \brief Reads a block of a 3D array in double precision.
+  //! \param[in] name The name (path in HDF5 file) to the array
+  //! \param[in] start Offset of the block in each direction
+  //! \param[in] count Size of the block in each direction
+  //! \param[out] data Values of the block, with the last index running fastest
+  bool read3DBlock(const std::string& name,
+                   const size_t* start, const size_t* count,
+                   std::vector<double>& data);
+
   //! \brief Returns number of patches for a field.
   //! \param[in] fieldPath Path to field in hdf5 file
   int getFieldSize(const std::string& fieldPath);
@@ -15,6 +15,7 @@
 #define _HDF5_RESTART_H
 
 #include "HDF5Base.h"
+#include "MemoryLog.h"
 #include <map>
 
 class TimeStep;
@@ -55,7 +56,14 @@ public:
   int readData(SerializeData& data, int level = -1);
 
 private:
+  //! \brief Registers the size of the serialized data in the memory log.
+  //! \details Only the peak figures are affected, since the data is owned
+  //! by the caller.
+  void trackMemory(const SerializeData& data);
+
   int m_stride; //!< Stride between outputs
+
+  utl::MemTracker m_memory; //!< Memory accounting of the serialized data
 };
 
 #endif
@@ -24,6 +24,11 @@ class SIMbase;
   \brief Write data to a HDF5 file.
 
   \details The HDF5 writer writes data to a HDF5 file. It supports parallel I/O.
+  The data arrays of each data entry are queued and written at the end of
+  the corresponding write method, such that the offsets of all processes can
+  be computed in one exchange and the datasets can be written using
+  collective MPI-IO. All processes must therefore queue the same arrays,
+  in the same order, using zero length for the arrays they do not own.
 */
 
 class HDF5Writer : public DataWriter, public HDF5Base
@@ -36,8 +41,8 @@ public:
   HDF5Writer(const std::string& name, const ProcessAdm& adm,
              bool append = false);
 
-  //! \brief Empty destructor.
-  virtual ~HDF5Writer() {}
+  //! \brief The destructor reports any data arrays not written.
+  virtual ~HDF5Writer();
 
   //! \brief Returns the last time level stored in the HDF5 file.
   virtual int getLastTimeLevel();
@@ -95,6 +100,9 @@ public:
 #ifdef HAS_HDF5
 protected:
   //! \brief Internal helper function writing a data array to file.
+  //! \details The array is only queued here, it is written by flushArrays().
+  //! The data is copied, so it need not outlive this call.
+  //! This must be invoked by all processes for the same arrays in same order.
   //! \param[in] group The HDF5 group to write data into
   //! \param[in] name The name of the array
   //! \param[in] patch Patch number of the array
@@ -113,7 +121,25 @@ protected:
   void writeBasis(const SIMbase* SIM, const std::string& name,
                   int basis, int level, bool redundant = false);
 
+  //! \brief Creates and writes all pending data arrays.
+  //! \details The array lengths of all processes are exchanged in one
+  //! collective operation, after which the datasets are created and written
+  //! collectively, with each process writing its own slab of each dataset.
+  //! \return \e false if the processes have different number of arrays
+  bool flushArrays();
+
 private:
+  //! \brief Struct holding a data array pending for output.
+  struct PendingArray
+  {
+    std::string       path; //!< Full path of the dataset in the file
+    hid_t             type; //!< The HDF5 type of the data
+    int               len;  //!< Local length of the array
+    std::vector<char> data; //!< Local part of the array data
+  };
+
+  std::vector<PendingArray> m_pending; //!< Data arrays pending for output
+
   unsigned int m_flag; //!< The file flags to open HDF5 file with
 #endif
 };
@@ -0,0 +1,79 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MappedFile.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Read-only memory-mapped files and in-memory input streams.
+//!
+//==============================================================================
+
+#ifndef _MAPPED_FILE_H
+#define _MAPPED_FILE_H
+
+#include <streambuf>
+#include <string>
+
+
+namespace utl
+{
+  /*!
+    \brief Class representing the content of a read-only memory-mapped file.
+    \details On platforms without \a mmap, the file is read into memory.
+  */
+
+  class MappedFile
+  {
+  public:
+    //! \brief The constructor maps the given file.
+    explicit MappedFile(const std::string& fileName);
+    //! \brief The destructor unmaps the file.
+    ~MappedFile();
+
+    //! \brief Returns \e true if the file was successfully mapped.
+    bool good() const { return ok; }
+    //! \brief Returns a pointer to the file content.
+    const char* data() const { return buf; }
+    //! \brief Returns the size of the file (in bytes).
+    size_t size() const { return len; }
+
+  private:
+    //! \brief Disabled copy constructor.
+    MappedFile(const MappedFile&) = delete;
+    //! \brief Disabled assignment operator.
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    char*  buf;    //!< The file content
+    size_t len;    //!< Size of the file content
+    bool   mapped; //!< If \e true, \a buf is mapped, otherwise allocated
+    bool   ok;     //!< If \e true, the file content is available
+  };
+
+
+  /*!
+    \brief Stream buffer reading from a memory block without copying it.
+    \details Use this as the buffer of a std::istream to parse a part of a
+    memory-mapped file with the stream operators.
+  */
+
+  class MemStreamBuf : public std::streambuf
+  {
+  public:
+    //! \brief The constructor sets up the get area.
+    //! \param[in] data Start of the memory block
+    //! \param[in] n Size of the memory block
+    MemStreamBuf(const char* data, size_t n);
+
+  protected:
+    //! \brief Repositions the read pointer relative to a given position.
+    virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                             std::ios_base::openmode which);
+    //! \brief Repositions the read pointer to an absolute position.
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which);
+  };
+}
+
+#endif
@@ -0,0 +1,118 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MemoryLog.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Accounting of memory allocations by named categories.
+//!
+//==============================================================================
+
+#ifndef _MEMORY_LOG_H
+#define _MEMORY_LOG_H
+
+#include <functional>
+#include <iostream>
+#include <string>
+
+
+namespace utl
+{
+  /*!
+    \brief Global registry of memory consumption for named categories.
+
+    \details The major data containers (system matrices, equation solver
+    factors, patch topology, solution vector stacks, etc.) register the size
+    of their storage under a category name. The current and peak figures of
+    each category, and of their sum, are kept for the current process
+    (i.e., the current MPI rank). They can be queried from anywhere,
+    and are reported along with the profiling results at the end of the run.
+
+    The registry does not intercept any allocations itself. The figures
+    therefore reflect the storage sizes reported by the containers, which
+    is an estimate for node-based containers like std::map.
+  */
+
+  class MemoryLog
+  {
+  public:
+    //! \brief Registers an allocation (or release if negative) of memory.
+    //! \param[in] category Name of the memory category
+    //! \param[in] nBytes Number of bytes allocated (positive) or released
+    static void allocate(const std::string& category, long long int nBytes);
+
+    //! \brief Returns the current memory (in bytes) in the given category.
+    static size_t current(const std::string& category);
+    //! \brief Returns the peak memory (in bytes) in the given category.
+    static size_t peak(const std::string& category);
+    //! \brief Returns the current memory (in bytes) for all categories.
+    static size_t totalCurrent();
+    //! \brief Returns the peak memory (in bytes) for all categories together.
+    static size_t totalPeak();
+    //! \brief Returns the peak resident set size (in bytes) of this process.
+    static size_t peakRSS();
+
+    //! \brief Updates the memory figures of all trackers with a size function.
+    static void sample();
+
+    //! \brief Prints a memory report for all registered categories.
+    static void report(std::ostream& os);
+    //! \brief Clears all memory figures.
+    static void clear();
+  };
+
+
+  /*!
+    \brief Tracks the memory of one data container in a MemoryLog category.
+
+    \details Objects of this class are intended as data members of the
+    containers whose memory is to be accounted for. The owner calls the
+    set() method whenever its storage size changes significantly,
+    and the memory is released from the category when the tracker is
+    destroyed. A copied tracker starts at zero, since the copied container
+    is responsible for registering its own storage.
+
+    For containers that are resized from many places, a size function can be
+    given instead. The tracker then evaluates it in update(), and whenever
+    the MemoryLog figures are queried, such that no resize is missed.
+  */
+
+  class MemTracker
+  {
+  public:
+    //! \brief The constructor associates the tracker with a category.
+    explicit MemTracker(const char* category) : name(category), bytes(0) {}
+    //! \brief Constructor for a tracker with a size function.
+    //! \param[in] category Name of the memory category
+    //! \param[in] sizeFunc Returns the current storage size, in bytes
+    MemTracker(const char* category, const std::function<size_t()>& sizeFunc);
+    //! \brief Copy constructor.
+    //! \details The size function is not copied, since it refers to the
+    //! storage of the original container.
+    MemTracker(const MemTracker& t) : name(t.name), bytes(0) {}
+    //! \brief The destructor releases the tracked memory.
+    ~MemTracker();
+
+    //! \brief Assignment operator, the memory figure is not copied.
+    MemTracker& operator=(const MemTracker&) { return *this; }
+
+    //! \brief Updates the tracked memory size.
+    //! \param[in] nBytes Current storage size of the container, in bytes
+    void set(size_t nBytes);
+    //! \brief Updates the tracked memory size from the size function.
+    void update() { if (size) this->set(size()); }
+    //! \brief Returns the tracked memory size.
+    size_t get() const { return bytes; }
+
+  private:
+    const char* name;  //!< Name of the memory category
+    size_t      bytes; //!< Currently tracked number of bytes
+
+    std::function<size_t()> size; //!< Returns the current storage size
+  };
+}
+
+#endif
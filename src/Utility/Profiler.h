@@ -31,6 +31,7 @@
 
   The profiling results are printed in a nicely formatted table when the
   profiler object goes out of scope, typically at the end of the program.
+  The memory figures registered in utl::MemoryLog are printed along with it.
 */
 
 class Profiler
@@ -0,0 +1,64 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SplineQuadrature.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Patch-wide Gaussian quadrature rules for univariate spline spaces.
+//!
+//==============================================================================
+
+#ifndef _SPLINE_QUADRATURE_H
+#define _SPLINE_QUADRATURE_H
+
+#include <vector>
+
+
+/*!
+  \brief Patch-wide Gaussian quadrature rules for univariate spline spaces.
+
+  \details A quadrature rule with \a n points and weights can integrate
+  exactly all functions in a space of dimension \a 2n. For spline spaces of
+  high continuity, this is far less than the number of element-wise Gauss
+  points needed to integrate the piece-wise polynomials exactly. The rules
+  are computed for the actual knot vector by Newton iterations on the moment
+  equations, starting from an initial guess based on the Greville abscissae.
+*/
+
+namespace SplineQuadrature
+{
+  //! \brief Returns the knot vector of the products of two spline functions.
+  //! \param[in] knots Open knot vector of the spline space
+  //! \param[in] p Polynomial degree of the spline space
+  //!
+  //! \details The product space is of degree \a 2p and has one lower
+  //! continuity than the spline space itself at each interior knot,
+  //! such that it also contains the products of the first derivatives.
+  std::vector<double> productKnots(const std::vector<double>& knots, int p);
+
+  //! \brief Computes a Gaussian quadrature rule for a univariate spline space.
+  //! \param[in] knots Open knot vector of the spline space to integrate exactly
+  //! \param[in] p Polynomial degree of the spline space
+  //! \param[out] xg Parameter values of the quadrature points, in ascending
+  //! order
+  //! \param[out] wg Quadrature weights
+  //! \return \e false if the iterations did not converge to a valid rule,
+  //! i.e., with all points inside the domain and positive weights
+  bool getRule(const std::vector<double>& knots, int p,
+               std::vector<double>& xg, std::vector<double>& wg);
+
+  //! \brief Evaluates the non-zero B-splines and derivatives at a point.
+  //! \param[in] knots Open knot vector of the spline space
+  //! \param[in] p Polynomial degree of the spline space
+  //! \param[in] x Parameter value of the evaluation point
+  //! \param[out] N Values of the \a p+1 non-zero B-splines at \a x
+  //! \param[out] dN First derivatives of the non-zero B-splines at \a x
+  //! \return 0-based index of the first non-zero B-spline
+  int evalBasis(const std::vector<double>& knots, int p, double x,
+                std::vector<double>& N, std::vector<double>& dN);
+}
+
+#endif
@@ -0,0 +1,62 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SplineTransfer.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Transfer operators between nested univariate spline spaces.
+//!
+//==============================================================================
+
+#ifndef _SPLINE_TRANSFER_H
+#define _SPLINE_TRANSFER_H
+
+#include "MatVec.h"
+
+
+/*!
+  \brief Transfer operators between univariate spline spaces.
+
+  \details These methods are used to set up the prolongation operators of
+  spline-based multigrid methods. The coarse spaces are obtained by removing
+  every second distinct interior knot (h-coarsening), which is the inverse of
+  uniform refinement, or by replacing the basis by piece-wise linear functions
+  on the same knot spans (p-coarsening).
+*/
+
+namespace SplineTransfer
+{
+  //! \brief Returns the knot vector with every second interior knot removed.
+  //! \param[in] knots Open knot vector of the spline space
+  //! \param[in] p Polynomial degree of the spline space
+  //!
+  //! \details All copies of the removed knots are removed, whereas the
+  //! multiplicity of the remaining knots is retained. If there are no
+  //! interior knots, the knot vector is returned unchanged.
+  RealArray coarsenKnots(const RealArray& knots, int p);
+
+  //! \brief Returns the knot vector of the continuous linear spline space
+  //! on the same knot spans as the given spline space.
+  //! \param[in] knots Open knot vector of the spline space
+  RealArray linearKnots(const RealArray& knots);
+
+  //! \brief Computes the prolongation matrix from a coarse to a fine space.
+  //! \param[in] coarse Knot vector of the coarse spline space
+  //! \param[in] pc Polynomial degree of the coarse spline space
+  //! \param[in] fine Knot vector of the fine spline space
+  //! \param[in] pf Polynomial degree of the fine spline space
+  //! \param[out] P The prolongation matrix (fine basis x coarse basis)
+  //! \return \e false if the spaces are not compatible
+  //!
+  //! \details If the two spaces are of the same degree, the coarse space must
+  //! be a subspace of the fine space, and the exact knot insertion operator
+  //! is returned. If the coarse space is linear, the coarse functions are
+  //! instead interpolated at the Greville abscissae of the fine space.
+  bool prolongation(const RealArray& coarse, int pc,
+                    const RealArray& fine, int pf, Matrix& P);
+}
+
+#endif
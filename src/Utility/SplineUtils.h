@@ -20,8 +20,11 @@ class FunctionBase;
 class Vec4;
 class Vec3;
 
+namespace utl { class TensorBasis; }
+
 namespace Go {
   class Point;
+  class BsplineBasis;
   struct BasisDerivsSf;
   struct BasisDerivsSf2;
   struct BasisDerivsSf3;
@@ -66,6 +69,15 @@ namespace SplineUtils //! Various utility functions on spline objects.
   void extractBasis(const Go::BasisDerivs2& spline,
                     Vector& N, Matrix& dNdu, Matrix3D& d2Ndu2);
 
+  //! \brief Evaluates univariate basis functions for a tensor-product basis.
+  //! \param[in] basis The spline basis of one parameter direction
+  //! \param[in] gpar Parameter values of all evaluation points in \a basis
+  //! \param[in] nDer Number of derivatives to evaluate
+  //! \param[out] tb The tensor-product basis values
+  //! \param[in] dir 0-based parameter direction of \a basis
+  void evalBasis1D(const Go::BsplineBasis& basis, const Matrix& gpar,
+                   int nDer, utl::TensorBasis& tb, size_t dir);
+
   //! \brief Projects a spatial function onto a spline curve.
   Go::SplineCurve* project(const Go::SplineCurve* curve,
                            const FunctionBase& f,
@@ -0,0 +1,88 @@
+// $Id$
+//==============================================================================
+//!
+//! \file TensorBasis.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Tensor-product basis functions formed from univariate values.
+//!
+//==============================================================================
+
+#ifndef _TENSOR_BASIS_H
+#define _TENSOR_BASIS_H
+
+#include "MatVec.h"
+
+
+namespace utl
+{
+  /*!
+    \brief Storage of univariate basis function values for tensor-product
+    patches, from which the multivariate basis functions are formed on demand.
+
+    \details For each parameter direction, the values and derivatives of the
+    \a p nonzero univariate basis functions are stored for each evaluation
+    point, in the layout of \a Go::BsplineBasis::computeBasisValues, i.e.,
+    derivative \a d of function \a i is found at position \a i*(nDer+1)+d.
+    The points are numbered consecutively within each direction, such that
+    the storage scales with the sum of points in each direction, and not with
+    their product as when storing the multivariate values at all points.
+  */
+
+  class TensorBasis
+  {
+  public:
+    //! \brief The constructor allocates the parameter directions.
+    //! \param[in] nsd Number of parameter directions (2 or 3)
+    explicit TensorBasis(size_t nsd = 3) : dirs(nsd) {}
+
+    //! \brief Allocates storage for the univariate values in one direction.
+    //! \param[in] dir 0-based parameter direction
+    //! \param[in] nPt Number of evaluation points in this direction
+    //! \param[in] order Polynomial order (number of nonzero functions)
+    //! \param[in] nDer Number of derivatives to store for each function
+    void resize(size_t dir, size_t nPt, int order, int nDer);
+
+    //! \brief Returns the univariate values of direction \a dir at point
+    //! \a ipt (0-based) for update.
+    double* values(size_t dir, size_t ipt)
+    {
+      Direction& d = dirs[dir];
+      return d.vals.data() + ipt*d.order*(d.nDer+1);
+    }
+
+    //! \brief Returns the number of parameter directions.
+    size_t dim() const { return dirs.size(); }
+    //! \brief Returns the size (in bytes) of the stored univariate values.
+    size_t memSize() const;
+
+    //! \brief Forms the basis functions and first derivatives at a point.
+    //! \param[in] ipt 0-based univariate point index in each direction
+    //! \param[out] N Basis function values
+    //! \param[out] dNdu First derivatives of the basis functions
+    void extract(const int* ipt, Vector& N, Matrix& dNdu) const;
+    //! \brief Forms the basis functions with 1st and 2nd derivatives at a point.
+    //! \param[in] ipt 0-based univariate point index in each direction
+    //! \param[out] N Basis function values
+    //! \param[out] dNdu First derivatives of the basis functions
+    //! \param[out] d2Ndu2 Second derivatives of the basis functions
+    void extract(const int* ipt, Vector& N, Matrix& dNdu,
+                 Matrix3D& d2Ndu2) const;
+
+  private:
+    //! \brief Univariate values in one parameter direction.
+    struct Direction
+    {
+      int order = 1; //!< Number of nonzero functions at each point
+      int nDer  = 0; //!< Number of stored derivatives
+      RealArray vals; //!< Function values and derivatives at all points
+    };
+
+    std::vector<Direction> dirs; //!< Univariate values for each direction
+  };
+}
+
+#endif
@@ -15,16 +15,28 @@
 #define TEXTURE_PROPERTIES_H_
 
 #include "Function.h"
-#include "MatVec.h"
 #include <map>
 
 class TiXmlElement;
 class Vec3;
 
 
-//! \brief Class containing a set of properties defined through a texture map.
+/*!
+  \brief Class containing a set of properties defined through a texture map.
+
+  \details The texture values are stored in their native precision, i.e.,
+  8-bit for images, and 8-bit, 16-bit, single or double precision for HDF5
+  arrays. Wider integer arrays are stored in double precision.
+
+  Integrands should look up the property handle once through \a getHandle,
+  and use the handle when evaluating the property in the integration points.
+*/
+
 class TextureProperties {
 public:
+  //! \brief Sampling of the texture values.
+  enum Sampling { NEAREST, LINEAR };
+
   //! \brief Parse an XML definition.
   //! param elem XML element to parse
   void parse (const TiXmlElement* elem);
@@ -32,26 +44,56 @@ public:
   //! \brief Print property information to log.
   void printLog() const;
 
+  //! \brief Returns the handle of a property, or -1 if not available.
+  //! \param[in] name Name of property
+  int getHandle(const std::string& name) const;
+
   //! \brief Get value for a property
   //! \param[in] name Name of property
   //! \param[in] X Position (including parameter values) to evaluate property for
   //! \param[out] val Property value
   bool getProperty(const std::string& name, const Vec3& X, double& val) const;
+  //! \brief Get value for a property
+  //! \param[in] handle Handle of property
+  //! \param[in] X Position (including parameter values) to evaluate property for
+  //! \param[out] val Property value
+  bool getProperty(int handle, const Vec3& X, double& val) const;
 
   //! \brief Check if a property is available.
   //! \param name Name of property
   bool hasProperty(const std::string& name) const;
 
+  //! \brief Returns the memory used by the texture data (in bytes).
+  size_t getMemoryUsage() const;
+
 protected:
   //! \brief Struct holding information about a property.
   struct Property {
-    double min; //!< Minimum value
-    double max; //!< Maximum value
-    Matrix3D textureData; //!< Texture data
+    double min = 0.0; //!< Minimum value
+    double max = 1.0; //!< Maximum value
     bool prescaled = false; //!< True if data is already scaled
+    Sampling sampling = NEAREST; //!< Sampling of the texture values
+    int nbyte = 1; //!< Byte size of the texture values (1, 2, 4 or 8)
+    size_t dims[3] = {1,1,1}; //!< Size of the texture
+
+    std::vector<unsigned char> data8; //!< 8-bit texture data
+    std::vector<unsigned short> data16; //!< 16-bit texture data
+    std::vector<float> dataF; //!< Single precision texture data
+    std::vector<double> dataD; //!< Double precision texture data
+
+    //! \brief Returns the scaled value of a voxel.
+    //! \param[in] idx Texture indices of the voxel (0-based)
+    //! \param[out] val Voxel value
+    //! \return \e false if the voxel is outside the texture
+    bool voxel(const size_t* idx, double& val) const;
+    //! \brief Reads the texture from HDF5 file.
+    //! \param[in] file Name of the HDF5 file
+    //! \param[in] name Name of the HDF5 array
+    bool read(const std::string& file, const std::string& name);
   };
 
-  std::map<std::string, Property> properties; //!< Map of available properties
+  std::vector<Property> properties; //!< Available properties
+  std::map<std::string,int> handles; //!< Property handle for each name
 };
 
 
@@ -62,7 +104,7 @@ public:
   //! \param prop Name of property
   //! \param props Texture property container
   PropertyFunc(const std::string& prop, const TextureProperties& props)
-     : m_prop(prop), m_props(props)
+     : m_prop(prop), m_props(props), m_handle(props.getHandle(prop))
    {}
 
   //! \brief Empty destructor.
@@ -72,14 +114,18 @@ public:
   //! \param X Position to evaluate in
   double evaluate(const Vec3& X) const override
   {
-    double val;
-    m_props.getProperty(m_prop, X, val);
+    double val = 0.0;
+    if (m_handle >= 0)
+      m_props.getProperty(m_handle, X, val);
+    else
+      m_props.getProperty(m_prop, X, val);
     return val;
   }
 
 protected:
   std::string m_prop; //!< Name of property
   const TextureProperties& m_props; //!< Texture properties container
+  int m_handle; //!< Handle of property, if defined at construction
 };
 
 #endif
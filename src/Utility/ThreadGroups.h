@@ -63,6 +63,15 @@ public:
   //! \param[in] nel3 Number of elements in the third direction
   //! \param[in] minsize Minimum element strip size
   void calcGroups(int nel1, int nel2, int nel3, int minsize);
+  //! \brief Calculates a colouring of a subset of the elements.
+  //! \param[in] elms The elements to partition
+  //! \param[in] MNPC Element-node connectivity table
+  //!
+  //! \details Elements sharing a node are assigned different colours.
+  //! The colours are stored as the threads of the first group, in the same
+  //! way as for the unstructured (LR) patches, i.e., the elements of each
+  //! colour can be processed in parallel.
+  void calcGroups(const IntVec& elms, const IntMat& MNPC);
   //! \brief Initializes the threading groups in case of no multi-threading.
   //! \param[in] nel Total number of elements
   void oneGroup(size_t nel);